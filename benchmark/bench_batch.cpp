@@ -0,0 +1,76 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+#include "bench_enums.hpp"
+
+#include <magic_enum_batch.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t batch_size = 1 << 20;
+
+struct batch_inputs {
+  std::vector<std::string_view> names;
+  std::vector<bench::Large> values;
+
+  static batch_inputs& get() {
+    static batch_inputs in{};
+    return in;
+  }
+
+ private:
+  batch_inputs() : values(batch_size) {
+    for (auto i : bench::uniform_indexes(batch_size, magic_enum::enum_count<bench::Large>())) {
+      names.push_back(magic_enum::enum_names<bench::Large>()[i]);
+    }
+  }
+};
+
+// One iteration converts one name, batches of batch_size names.
+template <std::size_t Threads>
+void bench_enum_cast_batch(std::size_t iterations) {
+  auto& in = batch_inputs::get();
+  const magic_enum::thread_executor executor{Threads};
+  std::size_t invalid = 0;
+  for (std::size_t done = 0; done < iterations; done += batch_size) {
+    const auto n = iterations - done < batch_size ? iterations - done : batch_size;
+    if constexpr (Threads == 1) {
+      invalid += magic_enum::enum_cast_batch<bench::Large>(in.names.data(), n, in.values.data());
+    } else {
+      invalid += magic_enum::enum_cast_batch<bench::Large>(executor, in.names.data(), n, in.values.data());
+    }
+  }
+  bench::do_not_optimize(invalid);
+  bench::do_not_optimize(in.values.data());
+}
+
+BENCHMARK("batch", "enum_cast_batch/large100/threads1", bench_enum_cast_batch<1>);
+BENCHMARK("batch", "enum_cast_batch/large100/threads2", bench_enum_cast_batch<2>);
+BENCHMARK("batch", "enum_cast_batch/large100/threads4", bench_enum_cast_batch<4>);
+BENCHMARK("batch", "enum_cast_batch/large100/threads8", bench_enum_cast_batch<8>);
+
+} // namespace
@@ -0,0 +1,67 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_BENCH_ENUMS_HPP
+#define NEARGYE_MAGIC_ENUM_BENCH_ENUMS_HPP
+
+#include <cstdint>
+
+// Enums are defined by X-macros X(name, value), so X-macro baselines see exactly the same enumerators.
+
+#define BENCH_SMALL(X) X(off, 0) X(low, 1) X(medium, 2) X(high, 3)
+
+#define BENCH_DENSE(X) \
+  X(nop, 0) X(load, 1) X(store, 2) X(add, 3) X(sub, 4) X(mul, 5) X(div, 6) X(jmp, 7) \
+  X(jz, 8) X(jnz, 9) X(call, 10) X(ret, 11) X(push, 12) X(pop, 13) X(cmp, 14) X(halt, 15)
+
+#define BENCH_LARGE(X) \
+  X(v00, 0) X(v01, 1) X(v02, 2) X(v03, 3) X(v04, 4) X(v05, 5) X(v06, 6) X(v07, 7) X(v08, 8) X(v09, 9) \
+  X(v10, 10) X(v11, 11) X(v12, 12) X(v13, 13) X(v14, 14) X(v15, 15) X(v16, 16) X(v17, 17) X(v18, 18) X(v19, 19) \
+  X(v20, 20) X(v21, 21) X(v22, 22) X(v23, 23) X(v24, 24) X(v25, 25) X(v26, 26) X(v27, 27) X(v28, 28) X(v29, 29) \
+  X(v30, 30) X(v31, 31) X(v32, 32) X(v33, 33) X(v34, 34) X(v35, 35) X(v36, 36) X(v37, 37) X(v38, 38) X(v39, 39) \
+  X(v40, 40) X(v41, 41) X(v42, 42) X(v43, 43) X(v44, 44) X(v45, 45) X(v46, 46) X(v47, 47) X(v48, 48) X(v49, 49) \
+  X(v50, 50) X(v51, 51) X(v52, 52) X(v53, 53) X(v54, 54) X(v55, 55) X(v56, 56) X(v57, 57) X(v58, 58) X(v59, 59) \
+  X(v60, 60) X(v61, 61) X(v62, 62) X(v63, 63) X(v64, 64) X(v65, 65) X(v66, 66) X(v67, 67) X(v68, 68) X(v69, 69) \
+  X(v70, 70) X(v71, 71) X(v72, 72) X(v73, 73) X(v74, 74) X(v75, 75) X(v76, 76) X(v77, 77) X(v78, 78) X(v79, 79) \
+  X(v80, 80) X(v81, 81) X(v82, 82) X(v83, 83) X(v84, 84) X(v85, 85) X(v86, 86) X(v87, 87) X(v88, 88) X(v89, 89) \
+  X(v90, 90) X(v91, 91) X(v92, 92) X(v93, 93) X(v94, 94) X(v95, 95) X(v96, 96) X(v97, 97) X(v98, 98) X(v99, 99)
+
+#define BENCH_SIGNED(X) \
+  X(m8, -8) X(m7, -7) X(m6, -6) X(m5, -5) X(m4, -4) X(m3, -3) X(m2, -2) X(m1, -1) \
+  X(z0, 0) X(p1, 1) X(p2, 2) X(p3, 3) X(p4, 4) X(p5, 5) X(p6, 6) X(p7, 7)
+
+#define BENCH_SPARSE(X) \
+  X(alpha, -100) X(bravo, -7) X(charlie, 0) X(delta, 3) X(echo, 42) X(foxtrot, 64) X(golf, 99) X(hotel, 120)
+
+#define BENCH_ENUMERATOR(name, value) name = value,
+
+namespace bench {
+
+enum class Small : std::uint8_t { BENCH_SMALL(BENCH_ENUMERATOR) };
+enum class Dense : std::uint8_t { BENCH_DENSE(BENCH_ENUMERATOR) };
+enum class Large : std::uint8_t { BENCH_LARGE(BENCH_ENUMERATOR) };
+enum class Signed : std::int8_t { BENCH_SIGNED(BENCH_ENUMERATOR) };
+enum class Sparse : int { BENCH_SPARSE(BENCH_ENUMERATOR) };
+
+} // namespace bench
+
+#endif // NEARGYE_MAGIC_ENUM_BENCH_ENUMS_HPP
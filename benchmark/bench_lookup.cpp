@@ -0,0 +1,262 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+#include "bench_enums.hpp"
+
+#include <magic_enum.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using bench::Small;
+using bench::Dense;
+using bench::Large;
+using bench::Signed;
+using bench::Sparse;
+
+#define BENCH_NAME_CASE(name, value) case value: return #name;
+#define BENCH_CAST_NAME(name, value) if (s == #name) return static_cast<E>(value);
+#define BENCH_CAST_INTEGER(name, value) case value: return static_cast<E>(value);
+
+// X-macro baselines: switch on integer for value to name and integer to value, chain of comparisons for name to value.
+#define BENCH_XMACRO(Enum, LIST) \
+  [[maybe_unused]] std::string_view xmacro_name(Enum value) { \
+    switch (static_cast<int>(value)) { LIST(BENCH_NAME_CASE) } \
+    return {}; \
+  } \
+  [[maybe_unused]] std::optional<Enum> xmacro_cast(std::string_view s, Enum*) { \
+    using E = Enum; \
+    LIST(BENCH_CAST_NAME) \
+    return std::nullopt; \
+  } \
+  [[maybe_unused]] std::optional<Enum> xmacro_cast(int i, Enum*) { \
+    using E = Enum; \
+    switch (i) { LIST(BENCH_CAST_INTEGER) } \
+    return std::nullopt; \
+  }
+
+BENCH_XMACRO(Small, BENCH_SMALL)
+BENCH_XMACRO(Dense, BENCH_DENSE)
+BENCH_XMACRO(Large, BENCH_LARGE)
+BENCH_XMACRO(Signed, BENCH_SIGNED)
+BENCH_XMACRO(Sparse, BENCH_SPARSE)
+
+// Hand-written switch baseline.
+std::string_view switch_name(Small value) {
+  switch (value) {
+    case Small::off: return "off";
+    case Small::low: return "low";
+    case Small::medium: return "medium";
+    case Small::high: return "high";
+  }
+  return {};
+}
+
+enum class Distribution { uniform, zipf };
+
+constexpr std::size_t input_size = 4096;
+
+// Inputs for enum E: enum values, names, misspelled names and integers, in the same order of enum indexes.
+template <typename E, Distribution D>
+struct inputs {
+  std::vector<std::size_t> indexes;
+  std::vector<E> values;
+  std::vector<std::string_view> names;
+  std::vector<std::string> misses;
+  std::vector<int> integers;
+
+  static const inputs& get() {
+    static const inputs in{};
+    return in;
+  }
+
+ private:
+  inputs() {
+    constexpr auto count = magic_enum::enum_count<E>();
+    indexes = D == Distribution::uniform ? bench::uniform_indexes(input_size, count) : bench::zipf_indexes(input_size, count);
+    for (auto i : indexes) {
+      const auto value = magic_enum::enum_value<E>(i);
+      const auto name = magic_enum::enum_name(value);
+      values.push_back(value);
+      names.push_back(name);
+      // Same length and prefix as name, differs in last character.
+      misses.push_back(std::string{name.substr(0, name.size() - 1)} + '#');
+      integers.push_back(static_cast<int>(magic_enum::enum_integer(value)));
+    }
+  }
+};
+
+template <typename E, Distribution D>
+void bench_enum_cast_string_hit(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += magic_enum::enum_cast<E>(in.names[i % input_size]).has_value();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_enum_cast_string_miss(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += magic_enum::enum_cast<E>(std::string_view{in.misses[i % input_size]}).has_value();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_enum_cast_integer(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += magic_enum::enum_cast<E>(in.integers[i % input_size]).has_value();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_enum_name(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += magic_enum::enum_name(in.values[i % input_size]).size();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_enum_value(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += static_cast<std::size_t>(magic_enum::enum_value<E>(in.indexes[i % input_size]));
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_xmacro_cast_string_hit(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += xmacro_cast(in.names[i % input_size], static_cast<E*>(nullptr)).has_value();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_xmacro_cast_string_miss(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += xmacro_cast(std::string_view{in.misses[i % input_size]}, static_cast<E*>(nullptr)).has_value();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_xmacro_cast_integer(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += xmacro_cast(in.integers[i % input_size], static_cast<E*>(nullptr)).has_value();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <typename E, Distribution D>
+void bench_xmacro_name(std::size_t iterations) {
+  const auto& in = inputs<E, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += xmacro_name(in.values[i % input_size]).size();
+  }
+  bench::do_not_optimize(acc);
+}
+
+template <Distribution D>
+void bench_switch_name(std::size_t iterations) {
+  const auto& in = inputs<Small, D>::get();
+  std::size_t acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc += switch_name(in.values[i % input_size]).size();
+  }
+  bench::do_not_optimize(acc);
+}
+
+#define BENCH_LOOKUP(Enum, label, Dist) \
+  BENCHMARK("lookup", "enum_cast_string_hit/" label "/" #Dist, (bench_enum_cast_string_hit<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "xmacro_cast_string_hit/" label "/" #Dist, (bench_xmacro_cast_string_hit<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "enum_cast_string_miss/" label "/" #Dist, (bench_enum_cast_string_miss<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "xmacro_cast_string_miss/" label "/" #Dist, (bench_xmacro_cast_string_miss<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "enum_cast_integer/" label "/" #Dist, (bench_enum_cast_integer<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "xmacro_cast_integer/" label "/" #Dist, (bench_xmacro_cast_integer<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "enum_name/" label "/" #Dist, (bench_enum_name<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "xmacro_name/" label "/" #Dist, (bench_xmacro_name<Enum, Distribution::Dist>)); \
+  BENCHMARK("lookup", "enum_value/" label "/" #Dist, (bench_enum_value<Enum, Distribution::Dist>))
+
+BENCH_LOOKUP(Small, "small4", uniform);
+BENCH_LOOKUP(Small, "small4", zipf);
+BENCHMARK("lookup", "switch_name/small4/uniform", bench_switch_name<Distribution::uniform>);
+BENCHMARK("lookup", "switch_name/small4/zipf", bench_switch_name<Distribution::zipf>);
+BENCH_LOOKUP(Dense, "dense16", uniform);
+BENCH_LOOKUP(Dense, "dense16", zipf);
+BENCH_LOOKUP(Large, "large100", uniform);
+BENCH_LOOKUP(Large, "large100", zipf);
+BENCH_LOOKUP(Signed, "signed16", uniform);
+BENCH_LOOKUP(Signed, "signed16", zipf);
+BENCH_LOOKUP(Sparse, "sparse8", uniform);
+BENCH_LOOKUP(Sparse, "sparse8", zipf);
+
+enum class Flags : std::uint32_t { read = 1 << 0, write = 1 << 1, exec = 1 << 2, sync = 1 << 3 };
+
+template <bool Operators>
+void bench_bitwise(std::size_t iterations) {
+  const auto& in = inputs<Small, Distribution::uniform>::get();
+  Flags acc = Flags::read;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    const auto f = static_cast<Flags>(1U << in.indexes[i % input_size]);
+    if constexpr (Operators) {
+      using namespace magic_enum::bitwise_operators;
+      acc = ((acc | f) & ~Flags::sync) ^ Flags::exec;
+    } else {
+      const auto a = static_cast<std::uint32_t>(acc);
+      const auto b = static_cast<std::uint32_t>(f);
+      acc = static_cast<Flags>(((a | b) & ~static_cast<std::uint32_t>(Flags::sync)) ^ static_cast<std::uint32_t>(Flags::exec));
+    }
+  }
+  bench::do_not_optimize(acc);
+}
+
+BENCHMARK("bitwise", "bitwise_operators/flags4", bench_bitwise<true>);
+BENCHMARK("bitwise", "underlying/flags4", bench_bitwise<false>);
+
+} // namespace
@@ -0,0 +1,93 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <magic_enum.hpp>
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace {
+
+enum class Level { trace, debug, information, warning, error, critical_failure, off };
+
+const std::array<Level, 1024>& levels() {
+  static const auto values = [] {
+    std::array<Level, 1024> v{};
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> dist{0, magic_enum::enum_count<Level>() - 1};
+    for (auto& e : v) {
+      e = magic_enum::enum_value<Level>(dist(gen));
+    }
+    return v;
+  }();
+  return values;
+}
+
+// Baseline: previous implementation, one put() for each character.
+void put_each(std::ostream& os, Level value) {
+  for (auto c : magic_enum::enum_name(value)) {
+    os.put(c);
+  }
+}
+
+void write_operator(std::ostream& os, Level value) {
+  using namespace magic_enum::ostream_operators;
+  os << value;
+}
+
+template <void (*Write)(std::ostream&, Level)>
+void bench_ostringstream(std::size_t iterations) {
+  const auto& in = levels();
+  std::ostringstream os;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    if (i % 4096 == 0) {
+      os.str({});
+    }
+    Write(os, in[i % in.size()]);
+  }
+  bench::do_not_optimize(os.tellp());
+}
+
+template <void (*Write)(std::ostream&, Level)>
+void bench_ofstream(std::size_t iterations) {
+  const auto& in = levels();
+  const char* path = "magic_enum_bench_ostream.tmp";
+  {
+    std::ofstream os{path, std::ios::binary | std::ios::trunc};
+    for (std::size_t i = 0; i < iterations; ++i) {
+      Write(os, in[i % in.size()]);
+    }
+  }
+  std::remove(path);
+}
+
+BENCHMARK("ostream", "operator<</ostringstream", bench_ostringstream<write_operator>);
+BENCHMARK("ostream", "put_each/ostringstream", bench_ostringstream<put_each>);
+BENCHMARK("ostream", "operator<</ofstream", bench_ofstream<write_operator>);
+BENCHMARK("ostream", "put_each/ofstream", bench_ofstream<put_each>);
+
+} // namespace
@@ -0,0 +1,123 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <magic_enum_switch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+
+namespace {
+
+enum class Opcode : std::uint8_t { nop, load, store, add, sub, mul, div, jmp, jz, jnz, call, ret, push, pop, cmp, halt };
+
+enum class Sparse : int { a = -100, b = -7, c = 0, d = 3, e = 42, f = 64, g = 99, h = 120 };
+
+#if defined(_MSC_VER)
+#  define BENCH_NOINLINE __declspec(noinline)
+#else
+#  define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+template <auto V>
+BENCH_NOINLINE int handle(int x) {
+  return x * 3 + static_cast<int>(V);
+}
+
+template <typename E>
+const std::array<E, 1024>& inputs() {
+  static const auto values = [] {
+    std::array<E, 1024> v{};
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> dist{0, magic_enum::enum_count<E>() - 1};
+    for (auto& e : v) {
+      e = magic_enum::enum_value<E>(dist(gen));
+    }
+    return v;
+  }();
+  return values;
+}
+
+template <typename E>
+void bench_enum_switch(std::size_t iterations) {
+  const auto& in = inputs<E>();
+  int acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc = magic_enum::enum_switch([acc](auto v) { return handle<decltype(v)::value>(acc); }, in[i % in.size()]);
+  }
+  bench::do_not_optimize(acc);
+}
+
+int native_switch(Opcode op, int x) {
+  switch (op) {
+    case Opcode::nop: return handle<Opcode::nop>(x);
+    case Opcode::load: return handle<Opcode::load>(x);
+    case Opcode::store: return handle<Opcode::store>(x);
+    case Opcode::add: return handle<Opcode::add>(x);
+    case Opcode::sub: return handle<Opcode::sub>(x);
+    case Opcode::mul: return handle<Opcode::mul>(x);
+    case Opcode::div: return handle<Opcode::div>(x);
+    case Opcode::jmp: return handle<Opcode::jmp>(x);
+    case Opcode::jz: return handle<Opcode::jz>(x);
+    case Opcode::jnz: return handle<Opcode::jnz>(x);
+    case Opcode::call: return handle<Opcode::call>(x);
+    case Opcode::ret: return handle<Opcode::ret>(x);
+    case Opcode::push: return handle<Opcode::push>(x);
+    case Opcode::pop: return handle<Opcode::pop>(x);
+    case Opcode::cmp: return handle<Opcode::cmp>(x);
+    case Opcode::halt: return handle<Opcode::halt>(x);
+  }
+  return 0;
+}
+
+int native_switch(Sparse s, int x) {
+  switch (s) {
+    case Sparse::a: return handle<Sparse::a>(x);
+    case Sparse::b: return handle<Sparse::b>(x);
+    case Sparse::c: return handle<Sparse::c>(x);
+    case Sparse::d: return handle<Sparse::d>(x);
+    case Sparse::e: return handle<Sparse::e>(x);
+    case Sparse::f: return handle<Sparse::f>(x);
+    case Sparse::g: return handle<Sparse::g>(x);
+    case Sparse::h: return handle<Sparse::h>(x);
+  }
+  return 0;
+}
+
+template <typename E>
+void bench_native_switch(std::size_t iterations) {
+  const auto& in = inputs<E>();
+  int acc = 0;
+  for (std::size_t i = 0; i < iterations; ++i) {
+    acc = native_switch(in[i % in.size()], acc);
+  }
+  bench::do_not_optimize(acc);
+}
+
+BENCHMARK("switch", "enum_switch/dense16", bench_enum_switch<Opcode>);
+BENCHMARK("switch", "native_switch/dense16", bench_native_switch<Opcode>);
+BENCHMARK("switch", "enum_switch/sparse8", bench_enum_switch<Sparse>);
+BENCHMARK("switch", "native_switch/sparse8", bench_native_switch<Sparse>);
+
+} // namespace
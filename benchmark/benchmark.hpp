@@ -0,0 +1,119 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_BENCHMARK_HPP
+#define NEARGYE_MAGIC_ENUM_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+// Prevents compiler from optimizing away computation of value.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static const void* volatile sink;
+  sink = &value;
+#endif
+}
+
+struct benchmark {
+  std::string suite;
+  std::string name;
+  void (*run)(std::size_t iterations);
+};
+
+inline std::vector<benchmark>& registry() {
+  static std::vector<benchmark> benchmarks;
+  return benchmarks;
+}
+
+struct registrar {
+  registrar(std::string suite, std::string name, void (*run)(std::size_t iterations)) {
+    registry().push_back({std::move(suite), std::move(name), run});
+  }
+};
+
+// Returns nanoseconds per iteration of run, best of several repetitions.
+inline double measure(void (*run)(std::size_t iterations), std::size_t iterations) {
+  run(iterations / 10 + 1); // Warm up.
+  double best = 0.0;
+  for (int r = 0; r < 5; ++r) {
+    const auto start = std::chrono::steady_clock::now();
+    run(iterations);
+    const auto stop = std::chrono::steady_clock::now();
+    const auto ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+    if (r == 0 || ns < best) {
+      best = ns;
+    }
+  }
+
+  return best;
+}
+
+// Returns n indexes in [0, count) drawn from uniform distribution.
+inline std::vector<std::size_t> uniform_indexes(std::size_t n, std::size_t count) {
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<std::size_t> dist{0, count - 1};
+  std::vector<std::size_t> indexes(n);
+  for (auto& i : indexes) {
+    i = dist(gen);
+  }
+
+  return indexes;
+}
+
+// Returns n indexes in [0, count) drawn from Zipf distribution with exponent 1, index 0 is the most frequent.
+inline std::vector<std::size_t> zipf_indexes(std::size_t n, std::size_t count) {
+  std::vector<double> weights(count);
+  for (std::size_t k = 0; k < count; ++k) {
+    weights[k] = 1.0 / static_cast<double>(k + 1);
+  }
+  std::mt19937 gen{42};
+  std::discrete_distribution<std::size_t> dist{weights.begin(), weights.end()};
+  std::vector<std::size_t> indexes(n);
+  for (auto& i : indexes) {
+    i = dist(gen);
+  }
+
+  return indexes;
+}
+
+} // namespace bench
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+// Registers function void(std::size_t iterations) as benchmark case.
+#define BENCHMARK(suite, name, function) \
+  static const bench::registrar BENCH_CONCAT(bench_registrar_, __COUNTER__){suite, name, function}
+
+#endif // NEARGYE_MAGIC_ENUM_BENCHMARK_HPP
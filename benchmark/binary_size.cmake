@@ -0,0 +1,164 @@
+# Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+#
+# Permission is hereby  granted, free of charge, to any  person obtaining a copy
+# of this software and associated  documentation files (the "Software"), to deal
+# in the Software  without restriction, including without  limitation the rights
+# to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+# copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+# IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+# FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+# AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+# LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Measures binary size contributed by reflected enums: generates translation units with N synthetic enums,
+# compiles each at several optimization levels and reads section and symbol sizes of object files.
+# Prints CSV: opt,enums,text,rodata,text_per_enum,rodata_per_enum,name_impl,cast_impl,other_text,strings,constants,other_rodata.
+# text counts .text sections, rodata counts .rodata and .data.rel.ro sections. Per enum growth is relative to
+# translation unit without enums. name_impl, cast_impl and other_text are code bytes of magic_enum symbols over all enums.
+# Read-only data is attributed by section: strings is .rodata*.str* sections (names of enum values are sliced from
+# __PRETTY_FUNCTION__ text, which name_impl keeps whole), constants is .rodata.cst* sections (tables, which compiler
+# emits as unnamed constants), other_rodata is the rest. Tables like strings_v are constexpr copies local to
+# name_impl, so they have no symbols of their own. At -O0 GCC does not use mergeable string sections, strings are then
+# counted in other_rodata.
+#
+# Usage: cmake -DCXX=g++ -DINCLUDE_DIR=include -DOUTPUT_DIR=build/size [-DSIZE=size] [-DNM=nm]
+#              [-DENUMS=1;8;32] [-DVALUES=16] [-DOPT_LEVELS=-O0;-O2;-Os] [-DSTD=-std=c++17] -P binary_size.cmake
+
+foreach(var CXX INCLUDE_DIR OUTPUT_DIR)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "binary_size.cmake requires -D${var}=...")
+  endif()
+endforeach()
+if(NOT DEFINED SIZE)
+  set(SIZE size)
+endif()
+if(NOT DEFINED NM)
+  set(NM nm)
+endif()
+if(NOT DEFINED ENUMS)
+  set(ENUMS 1 8 32)
+endif()
+if(NOT DEFINED VALUES)
+  set(VALUES 16)
+endif()
+if(NOT DEFINED OPT_LEVELS)
+  set(OPT_LEVELS -O0 -O2 -Os)
+endif()
+if(NOT DEFINED STD)
+  set(STD -std=c++17)
+endif()
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+# Writes translation unit with n enums, each with name and cast functions which reflect it at runtime.
+function(generate n path)
+  set(source "#include <magic_enum.hpp>\n")
+  if(n GREATER 0)
+    math(EXPR last_enum "${n} - 1")
+    math(EXPR last_value "${VALUES} - 1")
+    foreach(e RANGE ${last_enum})
+      set(enumerators "")
+      foreach(v RANGE ${last_value})
+        string(APPEND enumerators "value_${v}, ")
+      endforeach()
+      string(APPEND source "enum class enum_${e} : int { ${enumerators}};\n")
+      string(APPEND source "std::string_view name_${e}(enum_${e} v) { return magic_enum::enum_name(v); }\n")
+      string(APPEND source "std::optional<enum_${e}> cast_${e}(std::string_view s) { return magic_enum::enum_cast<enum_${e}>(s); }\n")
+    endforeach()
+  endif()
+  file(WRITE ${path} "${source}")
+endfunction()
+
+# Sets <prefix>_text, <prefix>_rodata, <prefix>_name_impl, <prefix>_cast_impl, <prefix>_other_text, <prefix>_strings,
+# <prefix>_constants, <prefix>_other_rodata in parent scope.
+function(measure object prefix)
+  execute_process(COMMAND ${SIZE} -A ${object} OUTPUT_VARIABLE sections RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${SIZE} -A ${object} failed.")
+  endif()
+  execute_process(COMMAND ${NM} -S -C ${object} OUTPUT_VARIABLE symbols RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} -S -C ${object} failed.")
+  endif()
+
+  set(text 0)
+  set(rodata 0)
+  set(strings 0)
+  set(constants 0)
+  string(REPLACE "\n" ";" sections "${sections}")
+  foreach(line IN LISTS sections)
+    if(line MATCHES "^(\\.[^ ]+) +([0-9]+)")
+      set(section ${CMAKE_MATCH_1})
+      set(bytes ${CMAKE_MATCH_2})
+      if(section MATCHES "^\\.text")
+        math(EXPR text "${text} + ${bytes}")
+      elseif(section MATCHES "^\\.rodata|^\\.data\\.rel\\.ro")
+        math(EXPR rodata "${rodata} + ${bytes}")
+        if(section MATCHES "^\\.rodata.*\\.str")
+          math(EXPR strings "${strings} + ${bytes}")
+        elseif(section MATCHES "^\\.rodata\\.cst")
+          math(EXPR constants "${constants} + ${bytes}")
+        endif()
+      endif()
+    endif()
+  endforeach()
+  math(EXPR other_rodata "${rodata} - ${strings} - ${constants}")
+
+  set(name_impl 0)
+  set(cast_impl 0)
+  set(other_text 0)
+  string(REPLACE ";" "," symbols "${symbols}")
+  string(REPLACE "\n" ";" symbols "${symbols}")
+  foreach(line IN LISTS symbols)
+    if(line MATCHES "^[0-9a-f]+ ([0-9a-f]+) [tTwW] (.*)$")
+      math(EXPR bytes "0x${CMAKE_MATCH_1}")
+      set(symbol "${CMAKE_MATCH_2}")
+      if(symbol MATCHES "magic_enum::detail::name_impl")
+        math(EXPR name_impl "${name_impl} + ${bytes}")
+      elseif(symbol MATCHES "magic_enum::detail::cast_impl")
+        math(EXPR cast_impl "${cast_impl} + ${bytes}")
+      elseif(symbol MATCHES "magic_enum::")
+        math(EXPR other_text "${other_text} + ${bytes}")
+      endif()
+    endif()
+  endforeach()
+
+  foreach(var text rodata name_impl cast_impl other_text strings constants other_rodata)
+    set(${prefix}_${var} ${${var}} PARENT_SCOPE)
+  endforeach()
+endfunction()
+
+message("opt,enums,text,rodata,text_per_enum,rodata_per_enum,name_impl,cast_impl,other_text,strings,constants,other_rodata")
+foreach(opt IN LISTS OPT_LEVELS)
+  string(REGEX REPLACE "[^A-Za-z0-9]" "" tag "${opt}")
+  foreach(n 0 ${ENUMS})
+    set(source ${OUTPUT_DIR}/enums_${n}.cpp)
+    set(object ${OUTPUT_DIR}/enums_${n}_${tag}.o)
+    if(NOT EXISTS ${source})
+      generate(${n} ${source})
+    endif()
+    execute_process(COMMAND ${CXX} ${STD} ${opt} -I${INCLUDE_DIR} -c ${source} -o ${object} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "Failed to compile ${source} with ${opt}.")
+    endif()
+    measure(${object} size)
+    if(n EQUAL 0)
+      set(base_text ${size_text})
+      set(base_rodata ${size_rodata})
+    else()
+      math(EXPR text_per_enum "(${size_text} - ${base_text}) / ${n}")
+      math(EXPR rodata_per_enum "(${size_rodata} - ${base_rodata}) / ${n}")
+      message("${opt},${n},${size_text},${size_rodata},${text_per_enum},${rodata_per_enum},${size_name_impl},${size_cast_impl},${size_other_text},${size_strings},${size_constants},${size_other_rodata}")
+    endif()
+  endforeach()
+endforeach()
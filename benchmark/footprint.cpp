@@ -0,0 +1,58 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "bench_enums.hpp"
+
+#include <magic_enum.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+// Prints sizes in bytes of static reflection tables of enum types as CSV:
+// enum,count,range,strings,values,names,entries,indexes,characters,total.
+// Add enum types to report in main.
+
+namespace {
+
+template <typename E>
+void report(const char* name) {
+  constexpr auto bytes = magic_enum::table_bytes<E>();
+  constexpr auto range = magic_enum::detail::strings_v<E>.size();
+
+  std::cout << name << "," << magic_enum::enum_count<E>() << "," << range << ","
+            << bytes.strings << "," << bytes.values << "," << bytes.names << "," << bytes.entries << ","
+            << bytes.indexes << "," << bytes.characters << "," << bytes.total << std::endl;
+}
+
+} // namespace
+
+int main() {
+  std::cout << "enum,count,range,strings,values,names,entries,indexes,characters,total" << std::endl;
+
+  report<bench::Small>("small4");
+  report<bench::Dense>("dense16");
+  report<bench::Large>("large100");
+  report<bench::Signed>("signed16");
+  report<bench::Sparse>("sparse8");
+
+  return 0;
+}
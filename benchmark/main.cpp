@@ -0,0 +1,48 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#if !defined(MAGIC_ENUM_BENCH_VERSION)
+#  define MAGIC_ENUM_BENCH_VERSION "unknown"
+#endif
+
+// Runs all registered benchmarks, prints results as CSV: version,suite,name,ns_per_op.
+// Usage: magic_enum_bench [iterations] [filter]
+int main(int argc, char* argv[]) {
+  const std::size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  const char* filter = argc > 2 ? argv[2] : nullptr;
+
+  std::cout << "version,suite,name,ns_per_op" << std::endl;
+  for (const auto& b : bench::registry()) {
+    if (filter != nullptr && (b.suite + "/" + b.name).find(filter) == std::string::npos) {
+      continue;
+    }
+    std::cout << MAGIC_ENUM_BENCH_VERSION << "," << b.suite << "," << b.name << "," << bench::measure(b.run, iterations) << std::endl;
+  }
+
+  return 0;
+}
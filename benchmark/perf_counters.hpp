@@ -0,0 +1,128 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_PERF_COUNTERS_HPP
+#define NEARGYE_MAGIC_ENUM_PERF_COUNTERS_HPP
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace bench {
+
+// Group of hardware counters of calling thread in user mode, opened with perf_event_open.
+// Counters which are not supported by CPU, kernel or permissions (see /proc/sys/kernel/perf_event_paranoid) are skipped.
+class perf_counters {
+ public:
+  enum counter : std::size_t { cycles, instructions, branch_misses, l1d_misses, llc_misses, size };
+
+  static constexpr std::array<const char*, size> names = {{"cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"}};
+
+  perf_counters() noexcept {
+    constexpr std::uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    constexpr std::uint64_t llc_read_miss = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    const std::array<std::pair<std::uint32_t, std::uint64_t>, size> events = {{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE, l1d_read_miss},
+        {PERF_TYPE_HW_CACHE, llc_read_miss},
+    }};
+
+    for (std::size_t i = 0; i < size; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[i].first;
+      attr.config = events[i].second;
+      attr.disabled = leader_ < 0 ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      fds_[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+      if (fds_[i] >= 0) {
+        if (leader_ < 0) {
+          leader_ = fds_[i];
+        }
+        order_[opened_++] = i;
+      } else if (error_ == 0) {
+        error_ = errno;
+      }
+    }
+  }
+
+  perf_counters(const perf_counters&) = delete;
+  perf_counters& operator=(const perf_counters&) = delete;
+
+  ~perf_counters() {
+    for (auto fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+
+  // Returns true if at least one counter is available.
+  bool valid() const noexcept { return leader_ >= 0; }
+
+  bool available(counter c) const noexcept { return fds_[c] >= 0; }
+
+  // Returns errno of the first failed perf_event_open, 0 if all counters are available.
+  int error() const noexcept { return error_; }
+
+  void start() noexcept {
+    ::ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  // Stops counters, returns counts since start, zero for unavailable counters.
+  std::array<std::uint64_t, size> stop() noexcept {
+    ::ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    std::array<std::uint64_t, size + 1> buffer{}; // Number of counters, then values in order of opening.
+    std::array<std::uint64_t, size> result{};
+    if (::read(leader_, buffer.data(), sizeof(buffer)) > 0) {
+      for (std::size_t i = 0; i < buffer[0] && i < opened_; ++i) {
+        result[order_[i]] = buffer[i + 1];
+      }
+    }
+
+    return result;
+  }
+
+ private:
+  std::array<int, size> fds_{{-1, -1, -1, -1, -1}};
+  std::array<std::size_t, size> order_{};
+  std::size_t opened_ = 0;
+  int leader_ = -1;
+  int error_ = 0;
+};
+
+} // namespace bench
+
+#endif // NEARGYE_MAGIC_ENUM_PERF_COUNTERS_HPP
@@ -0,0 +1,181 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "benchmark.hpp"
+#include "bench_enums.hpp"
+#include "perf_counters.hpp"
+
+#include <magic_enum.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Measures hardware counters per call of lookup functions, with hot caches and with caches evicted before each call.
+// Prints results as CSV: cache,function,enum,cycles,instructions,branch_misses,l1d_misses,llc_misses, empty if counter is unavailable.
+// Usage: magic_enum_perf [calls] [evict_bytes]
+// Exits with code 77 (skipped, as for ctest SKIP_RETURN_CODE) if no counter can be opened.
+
+namespace {
+
+constexpr int skipped = 77;
+
+std::size_t calls = 10000;
+std::vector<unsigned char> eviction;
+
+// Evicts data caches by writing buffer larger than last level cache.
+void evict() {
+  for (std::size_t i = 0; i < eviction.size(); i += 64) {
+    eviction[i] += 1;
+  }
+  bench::do_not_optimize(eviction.data());
+}
+
+struct sample {
+  std::array<double, bench::perf_counters::size> per_call{};
+};
+
+// Counts of start() and stop() without work in between, subtracted from cold samples.
+std::array<std::uint64_t, bench::perf_counters::size> overhead(bench::perf_counters& counters) {
+  std::array<std::uint64_t, bench::perf_counters::size> best{};
+  for (int r = 0; r < 100; ++r) {
+    counters.start();
+    const auto c = counters.stop();
+    for (std::size_t i = 0; i < c.size(); ++i) {
+      best[i] = r == 0 || c[i] < best[i] ? c[i] : best[i];
+    }
+  }
+
+  return best;
+}
+
+template <typename Call>
+sample hot(bench::perf_counters& counters, const Call& call) {
+  for (std::size_t i = 0; i < calls; ++i) {
+    call(i);
+  }
+  counters.start();
+  for (std::size_t i = 0; i < calls; ++i) {
+    call(i);
+  }
+  const auto c = counters.stop();
+
+  sample s;
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    s.per_call[i] = static_cast<double>(c[i]) / static_cast<double>(calls);
+  }
+
+  return s;
+}
+
+template <typename Call>
+sample cold(bench::perf_counters& counters, const Call& call) {
+  const auto base = overhead(counters);
+  const std::size_t n = calls / 100 + 1; // Each call is preceded by eviction of whole buffer.
+  std::array<double, bench::perf_counters::size> total{};
+  for (std::size_t i = 0; i < n; ++i) {
+    evict();
+    counters.start();
+    call(i);
+    const auto c = counters.stop();
+    for (std::size_t j = 0; j < c.size(); ++j) {
+      total[j] += c[j] > base[j] ? static_cast<double>(c[j] - base[j]) : 0.0;
+    }
+  }
+
+  sample s;
+  for (std::size_t i = 0; i < total.size(); ++i) {
+    s.per_call[i] = total[i] / static_cast<double>(n);
+  }
+
+  return s;
+}
+
+void print(const bench::perf_counters& counters, const char* cache, const char* function, const char* name, const sample& s) {
+  std::cout << cache << "," << function << "," << name;
+  for (std::size_t i = 0; i < s.per_call.size(); ++i) {
+    std::cout << ",";
+    if (counters.available(static_cast<bench::perf_counters::counter>(i))) {
+      std::cout << s.per_call[i];
+    }
+  }
+  std::cout << std::endl;
+}
+
+template <typename E>
+void run(bench::perf_counters& counters, const char* name) {
+  const auto indexes = bench::uniform_indexes(calls, magic_enum::enum_count<E>());
+  std::vector<E> values;
+  std::vector<std::string_view> names;
+  std::vector<int> integers;
+  for (auto i : indexes) {
+    values.push_back(magic_enum::enum_value<E>(i));
+    names.push_back(magic_enum::enum_name(values.back()));
+    integers.push_back(static_cast<int>(magic_enum::enum_integer(values.back())));
+  }
+
+  const auto cast_string = [&](std::size_t i) { bench::do_not_optimize(magic_enum::enum_cast<E>(names[i % calls])); };
+  const auto cast_integer = [&](std::size_t i) { bench::do_not_optimize(magic_enum::enum_cast<E>(integers[i % calls])); };
+  const auto enum_name = [&](std::size_t i) { bench::do_not_optimize(magic_enum::enum_name(values[i % calls])); };
+
+  print(counters, "hot", "enum_cast_string", name, hot(counters, cast_string));
+  print(counters, "cold", "enum_cast_string", name, cold(counters, cast_string));
+  print(counters, "hot", "enum_cast_integer", name, hot(counters, cast_integer));
+  print(counters, "cold", "enum_cast_integer", name, cold(counters, cast_integer));
+  print(counters, "hot", "enum_name", name, hot(counters, enum_name));
+  print(counters, "cold", "enum_name", name, cold(counters, enum_name));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+  eviction.resize(argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 64 * 1024 * 1024);
+  if (calls == 0) {
+    calls = 1;
+  }
+
+  bench::perf_counters counters;
+  if (!counters.valid()) {
+    std::cerr << "perf_event_open is not available: " << std::strerror(counters.error())
+              << ", check /proc/sys/kernel/perf_event_paranoid or container seccomp profile." << std::endl;
+    return skipped;
+  }
+
+  std::cout << "cache,function,enum";
+  for (auto c : bench::perf_counters::names) {
+    std::cout << "," << c;
+  }
+  std::cout << std::endl;
+
+  run<bench::Small>(counters, "small4");
+  run<bench::Dense>(counters, "dense16");
+  run<bench::Large>(counters, "large100");
+  run<bench::Signed>(counters, "signed16");
+  run<bench::Sparse>(counters, "sparse8");
+
+  return 0;
+}
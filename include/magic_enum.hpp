@@ -34,7 +34,9 @@
 
 #include <array>
 #include <cassert>
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <limits>
 #include <string_view>
@@ -42,6 +44,10 @@
 #include <type_traits>
 #include <utility>
 
+#if defined(MAGIC_ENUM_STATS)
+#  include <atomic>
+#endif
+
 // Enum value must be greater or equals than MAGIC_ENUM_RANGE_MIN. By default MAGIC_ENUM_RANGE_MIN = -128.
 // If need another min range for all enum types by default, redefine the macro MAGIC_ENUM_RANGE_MIN.
 #if !defined(MAGIC_ENUM_RANGE_MIN)
@@ -54,6 +60,35 @@
 #  define MAGIC_ENUM_RANGE_MAX 128
 #endif
 
+// Declares that the reflection tables of enum type E are owned by one translation unit, see MAGIC_ENUM_DEFINE_TABLES.
+// Must be used at global scope, after including magic_enum.hpp and before any use of E with magic_enum.
+// In translation units that see this declaration, enum_name(value) and enum_cast(value) do not instantiate the tables of E,
+// they call the functions defined by MAGIC_ENUM_DEFINE_TABLES instead, and can not be used in constant expressions.
+// Only these calls go through the defined functions, other API still instantiates tables of E in translation unit
+// which uses it: enum_values, enum_names, enum_entries, enum_index, enum_switch, containers, json, binary, registry, batch.
+#define MAGIC_ENUM_DECLARE_TABLES(E)                                        \
+  namespace magic_enum::detail {                                            \
+  template <>                                                               \
+  struct extern_tables<E> : std::true_type {                                \
+    static std::string_view name(E value) noexcept;                         \
+    static std::optional<E> cast(std::string_view value) noexcept;          \
+    static std::optional<E> cast(std::underlying_type_t<E> value) noexcept; \
+  };                                                                        \
+  }
+
+// Defines the reflection tables of enum type E declared by MAGIC_ENUM_DECLARE_TABLES.
+// Must be used at global scope in exactly one translation unit of the program.
+#define MAGIC_ENUM_DEFINE_TABLES(E)                                                                       \
+  std::string_view magic_enum::detail::extern_tables<E>::name(E value) noexcept {                         \
+    return magic_enum::detail::name_impl<E>(value);                                                       \
+  }                                                                                                       \
+  std::optional<E> magic_enum::detail::extern_tables<E>::cast(std::string_view value) noexcept {          \
+    return magic_enum::detail::cast_impl<E>(value);                                                       \
+  }                                                                                                       \
+  std::optional<E> magic_enum::detail::extern_tables<E>::cast(std::underlying_type_t<E> value) noexcept { \
+    return magic_enum::detail::cast_impl<E>(value);                                                       \
+  }
+
 namespace magic_enum {
 
 // Enum value must be in range [MAGIC_ENUM_RANGE_MIN, MAGIC_ENUM_RANGE_MAX]. By default MAGIC_ENUM_RANGE_MIN = -128, MAGIC_ENUM_RANGE_MAX = 128.
@@ -136,6 +171,44 @@ template <typename E, E V>
 #endif
 }
 
+// Returns type name of enum as spelled by compiler in function signature, with namespaces and enclosing classes.
+template <typename E>
+[[nodiscard]] constexpr auto type_name_impl() noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::detail::type_name_impl requires enum type.");
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9)
+  // "... type_name_impl() [E = ns::Color]" or "... type_name_impl() [with E = ns::Color]".
+  constexpr std::string_view name{__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 2};
+  return name.substr(name.find("E = ") + 4);
+#elif defined(_MSC_VER)
+  // "auto __cdecl magic_enum::detail::type_name_impl<enum ns::Color>(void) noexcept".
+  constexpr std::string_view name{__FUNCSIG__, sizeof(__FUNCSIG__) - 1};
+  constexpr auto first = name.find("type_name_impl<") + 15;
+  constexpr auto type = name.substr(first, name.rfind(">(void)") - first);
+  return type.substr(0, 5) == "enum " ? type.substr(5) : type;
+#else
+  return std::string_view{}; // Unsupported compiler.
+#endif
+}
+
+// Null-terminated string of N characters in static storage.
+template <std::size_t N>
+struct static_string {
+  constexpr explicit static_string(std::string_view str) noexcept : chars{} {
+    for (std::size_t i = 0; i < N; ++i) {
+      chars[i] = str[i];
+    }
+  }
+
+  constexpr const char* data() const noexcept { return chars.data(); }
+
+  constexpr std::size_t size() const noexcept { return N; }
+
+  std::array<char, N + 1> chars;
+};
+
+template <typename E>
+inline constexpr auto type_name_v = static_string<type_name_impl<E>().size()>{type_name_impl<E>()};
+
 template <typename E, int... I>
 [[nodiscard]] constexpr auto strings_impl(std::integer_sequence<int, I...>) noexcept {
   static_assert(std::is_enum_v<E>, "magic_enum::detail::strings_impl requires enum type.");
@@ -180,6 +253,43 @@ inline constexpr auto values_v = values_impl<E>(range_v<E>);
 template <typename E>
 inline constexpr auto count_v = values_v<E>.size();
 
+template <typename E>
+using index_t = std::conditional_t<(count_v<E> < (std::numeric_limits<std::uint8_t>::max)()), std::uint8_t,
+                std::conditional_t<(count_v<E> < (std::numeric_limits<std::uint16_t>::max)()), std::uint16_t, std::size_t>>;
+
+template <typename E>
+inline constexpr auto invalid_index_v = (std::numeric_limits<index_t<E>>::max)();
+
+template <typename E>
+[[nodiscard]] constexpr auto indexes_impl() noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::detail::indexes_impl requires enum type.");
+  constexpr auto strings = strings_v<E>;
+
+  std::array<index_t<E>, strings.size()> indexes{};
+  for (std::size_t i = 0, v = 0; i < strings.size(); ++i) {
+    indexes[i] = strings[i].empty() ? invalid_index_v<E> : static_cast<index_t<E>>(v++);
+  }
+
+  return indexes;
+}
+
+// Maps (value - min_v<E>) to index in values_v<E>, or to invalid_index_v<E> if value does not have name.
+template <typename E>
+inline constexpr auto indexes_v = indexes_impl<E>();
+
+template <typename E>
+[[nodiscard]] constexpr std::size_t index_impl(E value) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::detail::index_impl requires enum type.");
+
+  if (auto i = static_cast<std::size_t>(static_cast<int>(value) - min_v<E>); i < indexes_v<E>.size()) {
+    if (auto index = indexes_v<E>[i]; index != invalid_index_v<E>) {
+      return index;
+    }
+  }
+
+  return count_v<E>; // Invalid value or out of range.
+}
+
 template <typename E, std::size_t... I>
 [[nodiscard]] constexpr auto names_impl(std::integer_sequence<std::size_t, I...>) noexcept {
   static_assert(std::is_enum_v<E>, "magic_enum::detail::names_impl requires enum type.");
@@ -190,6 +300,19 @@ template <typename E, std::size_t... I>
 template <typename E>
 inline constexpr auto names_v = names_impl<E>(std::make_index_sequence<count_v<E>>{});
 
+template <typename E>
+[[nodiscard]] constexpr std::size_t max_name_length_impl() noexcept {
+  std::size_t length = 0;
+  for (auto name : names_v<E>) {
+    length = name.size() > length ? name.size() : length;
+  }
+
+  return length;
+}
+
+template <typename E>
+inline constexpr auto max_name_length_v = max_name_length_impl<E>();
+
 template <typename E, std::size_t... I>
 [[nodiscard]] constexpr auto entries_impl(std::integer_sequence<std::size_t, I...>) noexcept {
   static_assert(std::is_enum_v<E>, "magic_enum::detail::entries_impl requires enum type.");
@@ -200,6 +323,104 @@ template <typename E, std::size_t... I>
 template <typename E>
 inline constexpr auto entries_v = entries_impl<E>(std::make_index_sequence<count_v<E>>{});
 
+template <typename E>
+[[nodiscard]] constexpr std::optional<E> cast_impl(std::string_view value) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::detail::cast_impl requires enum type.");
+  constexpr auto values = values_v<E>;
+  constexpr auto count = count_v<E>;
+  constexpr auto names = names_v<E>;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (names[i] == value) {
+      return values[i];
+    }
+  }
+
+  return std::nullopt; // Invalid value or out of range.
+}
+
+template <typename E>
+[[nodiscard]] constexpr std::optional<E> cast_impl(std::underlying_type_t<E> value) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::detail::cast_impl requires enum type.");
+
+  if (name_impl<E>(static_cast<E>(value)).empty()) {
+    return std::nullopt; // Invalid value or out of range.
+  }
+
+  return static_cast<E>(value);
+}
+
+// 64-bit FNV-1a hash.
+[[nodiscard]] constexpr std::uint64_t hash_fnv1a(std::string_view str, std::uint64_t hash = 14695981039346656037ULL) noexcept {
+  for (auto c : str) {
+    hash = (hash ^ static_cast<std::uint8_t>(c)) * 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+#if defined(MAGIC_ENUM_STATS)
+enum class stats_counter : std::size_t { cast_string_hit, cast_string_miss, cast_integer_hit, cast_integer_miss, name_empty, size };
+
+// Counters of enum type, linked in list of all enum types which counted anything.
+struct stats_node {
+  const char* type = nullptr;
+  std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(stats_counter::size)> counters{};
+  stats_node* next = nullptr;
+};
+
+inline std::atomic<stats_node*> stats_head{nullptr};
+
+template <typename E>
+stats_node& stats_impl() noexcept {
+  static stats_node* node = [] {
+    static stats_node n;
+    n.type = type_name_v<E>.data();
+    n.next = stats_head.load(std::memory_order_relaxed);
+    while (!stats_head.compare_exchange_weak(n.next, &n, std::memory_order_release, std::memory_order_relaxed)) {}
+    return &n;
+  }();
+
+  return *node;
+}
+
+template <typename E>
+void stats_increment(stats_counter counter) noexcept {
+  stats_impl<E>().counters[static_cast<std::size_t>(counter)].fetch_add(1, std::memory_order_relaxed);
+}
+
+// Counts hit or miss (next counter after hit) of enum_cast, not in constant evaluation.
+template <typename E>
+constexpr std::optional<E> stats_result(std::optional<E> result, stats_counter hit) noexcept {
+  if (!__builtin_is_constant_evaluated()) {
+    stats_increment<E>(result.has_value() ? hit : static_cast<stats_counter>(static_cast<std::size_t>(hit) + 1));
+  }
+
+  return result;
+}
+
+// Counts empty result of enum_name, not in constant evaluation.
+template <typename E>
+constexpr std::string_view stats_result(std::string_view result, stats_counter empty) noexcept {
+  if (!__builtin_is_constant_evaluated() && result.empty()) {
+    stats_increment<E>(empty);
+  }
+
+  return result;
+}
+
+#  define MAGIC_ENUM_STATS_RESULT(E, counter, ...) ::magic_enum::detail::stats_result<E>(__VA_ARGS__, ::magic_enum::detail::stats_counter::counter)
+#else
+#  define MAGIC_ENUM_STATS_RESULT(E, counter, ...) __VA_ARGS__
+#endif
+
+// Specialized by MAGIC_ENUM_DECLARE_TABLES for enum types which reflection tables are defined in one translation unit.
+template <typename E>
+struct extern_tables : std::false_type {};
+
+template <typename E>
+inline constexpr bool extern_tables_v = extern_tables<E>::value;
+
 template <typename T>
 using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
 
@@ -272,17 +493,12 @@ using underlying_type_t = typename underlying_type<T>::type;
 template <typename E, typename D = detail::enable_if_enum_t<E>>
 [[nodiscard]] constexpr std::optional<D> enum_cast(std::string_view value) noexcept {
   static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_cast requires enum type.");
-  constexpr auto values = detail::values_v<D>;
-  constexpr auto count = detail::count_v<D>;
-  constexpr auto names = detail::names_v<D>;
 
-  for (std::size_t i = 0; i < count; ++i) {
-    if (names[i] == value) {
-      return values[i];
-    }
+  if constexpr (detail::extern_tables_v<D>) {
+    return MAGIC_ENUM_STATS_RESULT(D, cast_string_hit, detail::extern_tables<D>::cast(value));
+  } else {
+    return MAGIC_ENUM_STATS_RESULT(D, cast_string_hit, detail::cast_impl<D>(value));
   }
-
-  return std::nullopt; // Invalid value or out of range.
 }
 
 // Obtains enum value from integer value.
@@ -291,11 +507,11 @@ template <typename E, typename D = detail::enable_if_enum_t<E>>
 [[nodiscard]] constexpr std::optional<D> enum_cast(std::underlying_type_t<D> value) noexcept {
   static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_cast requires enum type.");
 
-  if (detail::name_impl<D>(static_cast<D>(value)).empty()) {
-    return std::nullopt; // Invalid value or out of range.
+  if constexpr (detail::extern_tables_v<D>) {
+    return MAGIC_ENUM_STATS_RESULT(D, cast_integer_hit, detail::extern_tables<D>::cast(value));
+  } else {
+    return MAGIC_ENUM_STATS_RESULT(D, cast_integer_hit, detail::cast_impl<D>(value));
   }
-
-  return static_cast<D>(value);
 }
 
 // Returns integer value from enum value.
@@ -316,6 +532,19 @@ template<typename E, typename D = detail::enable_if_enum_t<E>>
   return assert(index < values.size()), values[index];
 }
 
+// Obtains index in enum value sequence from enum value.
+// Returns std::optional with index.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::optional<std::size_t> enum_index(E value) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_index requires enum type.");
+
+  if (auto index = detail::index_impl<D>(value); index < detail::count_v<D>) {
+    return index;
+  }
+
+  return std::nullopt; // Invalid value or out of range.
+}
+
 // Obtains value enum sequence.
 // Returns std::array with enum values, sorted by enum value.
 template <typename E, typename D = detail::enable_if_enum_t<E>>
@@ -335,6 +564,25 @@ template <typename E, typename D = detail::enable_if_enum_t<E>>
   return count;
 }
 
+// Returns type name of enum, with namespaces and enclosing classes, e.g. "ns::Color", null-terminated.
+// Spelling of unnamed namespaces and local types depends on compiler, empty if compiler is not supported.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::string_view enum_type_name() noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_type_name requires enum type.");
+  constexpr std::string_view name{detail::type_name_v<D>.data(), detail::type_name_v<D>.size()};
+
+  return name;
+}
+
+// Returns 64-bit FNV-1a hash of enum_type_name.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::uint64_t enum_type_hash() noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_type_hash requires enum type.");
+  constexpr auto hash = detail::hash_fnv1a(enum_type_name<D>());
+
+  return hash;
+}
+
 // Returns string enum name from static storage enum variable.
 // This version is much lighter on the compile times and is not restricted to the enum_range limitation.
 template <auto V, typename D = detail::enable_if_enum_t<decltype(V)>>
@@ -349,7 +597,11 @@ template <typename E, typename D = detail::enable_if_enum_t<E>>
 [[nodiscard]] constexpr std::string_view enum_name(E value) noexcept {
   static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_name requires enum type.");
 
-  return detail::name_impl<D>(value);
+  if constexpr (detail::extern_tables_v<D>) {
+    return MAGIC_ENUM_STATS_RESULT(D, name_empty, detail::extern_tables<D>::name(value));
+  } else {
+    return MAGIC_ENUM_STATS_RESULT(D, name_empty, detail::name_impl<D>(value));
+  }
 }
 
 // Obtains string enum name sequence.
@@ -372,15 +624,160 @@ template <typename E, typename D = detail::enable_if_enum_t<E>>
   return entries;
 }
 
+// Sizes in bytes of static reflection tables of enum type.
+// A table occupies read-only data only if it is used at runtime, e.g. enum_name(value) uses strings, enum_cast(string) uses values and names.
+struct enum_table_bytes {
+  std::size_t strings;    // String enum names of whole enum_range, indexed by value.
+  std::size_t values;     // Enum values sequence.
+  std::size_t names;      // String enum names sequence.
+  std::size_t entries;    // Pairs (value enum, string enum name) sequence.
+  std::size_t indexes;    // Indexes in enum values sequence of whole enum_range, indexed by value.
+  std::size_t characters; // Characters of string enum names, lower bound of string literals referenced by tables.
+  std::size_t total;      // Sum of above.
+};
+
+// Returns sizes in bytes of static reflection tables of enum type.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr enum_table_bytes table_bytes() noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::table_bytes requires enum type.");
+  enum_table_bytes bytes{sizeof(detail::strings_v<D>), sizeof(detail::values_v<D>), sizeof(detail::names_v<D>),
+                         sizeof(detail::entries_v<D>), sizeof(detail::indexes_v<D>), 0, 0};
+  for (auto name : detail::names_v<D>) {
+    bytes.characters += name.size();
+  }
+  bytes.total = bytes.strings + bytes.values + bytes.names + bytes.entries + bytes.indexes + bytes.characters;
+
+  return bytes;
+}
+
+// Writes string enum name to [first, last), without null-terminator.
+// Returns std::to_chars_result with ptr one past the last written character and ec std::errc{} on success,
+// ptr == last and ec std::errc::value_too_large if name does not fit, ptr == first and ec std::errc::invalid_argument if value does not have name.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+constexpr std::to_chars_result to_chars(char* first, char* last, E value) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::to_chars requires enum type.");
+  const auto name = enum_name(value);
+
+  if (name.empty()) {
+    return {first, std::errc::invalid_argument};
+  }
+  if (static_cast<std::size_t>(last - first) < name.size()) {
+    return {last, std::errc::value_too_large};
+  }
+  for (auto c : name) {
+    *first++ = c;
+  }
+
+  return {first, std::errc{}};
+}
+
+// Obtains enum value from string enum name at the beginning of [first, last).
+// Reads the longest sequence of characters allowed in enum names ([A-Za-z0-9_]), which must be a string enum name.
+// Returns std::from_chars_result with ptr one past the name and ec std::errc{} on success,
+// ptr == first and ec std::errc::invalid_argument if there is no string enum name, value is not modified on failure.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, E& value) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::from_chars requires enum type.");
+  auto it = first;
+
+  while (it != last && ((*it >= '0' && *it <= '9') || (*it >= 'a' && *it <= 'z') || (*it >= 'A' && *it <= 'Z') || *it == '_')) {
+    ++it;
+  }
+  if (it != first) {
+    if (auto v = enum_cast<D>(std::string_view{first, static_cast<std::size_t>(it - first)}); v.has_value()) {
+      value = v.value();
+      return {it, std::errc{}};
+    }
+  }
+
+  return {first, std::errc::invalid_argument};
+}
+
+#if defined(MAGIC_ENUM_STATS)
+// Runtime counters of enum_cast and enum_name results per enum type, enabled by defining MAGIC_ENUM_STATS.
+namespace stats {
+
+struct entry {
+  const char* type;
+  std::uint64_t cast_string_hits;
+  std::uint64_t cast_string_misses;
+  std::uint64_t cast_integer_hits;
+  std::uint64_t cast_integer_misses;
+  std::uint64_t name_empty;
+};
+
+// Calls visitor with entry of each enum type which counted anything, most recently registered first.
+template <typename Visitor>
+void visit(Visitor&& visitor) {
+  for (auto* node = detail::stats_head.load(std::memory_order_acquire); node != nullptr; node = node->next) {
+    const auto counter = [node](detail::stats_counter c) { return node->counters[static_cast<std::size_t>(c)].load(std::memory_order_relaxed); };
+    visitor(entry{node->type,
+                  counter(detail::stats_counter::cast_string_hit),
+                  counter(detail::stats_counter::cast_string_miss),
+                  counter(detail::stats_counter::cast_integer_hit),
+                  counter(detail::stats_counter::cast_integer_miss),
+                  counter(detail::stats_counter::name_empty)});
+  }
+}
+
+// Returns entry of enum type E.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+entry get() noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::stats::get requires enum type.");
+  auto& node = detail::stats_impl<D>();
+  const auto counter = [&node](detail::stats_counter c) { return node.counters[static_cast<std::size_t>(c)].load(std::memory_order_relaxed); };
+
+  return {node.type,
+          counter(detail::stats_counter::cast_string_hit),
+          counter(detail::stats_counter::cast_string_miss),
+          counter(detail::stats_counter::cast_integer_hit),
+          counter(detail::stats_counter::cast_integer_miss),
+          counter(detail::stats_counter::name_empty)};
+}
+
+// Writes one line per enum type: type cast_string_hits=N cast_string_misses=N cast_integer_hits=N cast_integer_misses=N name_empty=N.
+template <typename Char, typename Traits>
+std::basic_ostream<Char, Traits>& dump(std::basic_ostream<Char, Traits>& os) {
+  visit([&os](const entry& e) {
+    os << e.type
+       << " cast_string_hits=" << e.cast_string_hits
+       << " cast_string_misses=" << e.cast_string_misses
+       << " cast_integer_hits=" << e.cast_integer_hits
+       << " cast_integer_misses=" << e.cast_integer_misses
+       << " name_empty=" << e.name_empty << '\n';
+  });
+
+  return os;
+}
+
+// Sets all counters to zero, enum types stay registered.
+inline void reset() noexcept {
+  for (auto* node = detail::stats_head.load(std::memory_order_acquire); node != nullptr; node = node->next) {
+    for (auto& c : node->counters) {
+      c.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+} // namespace magic_enum::stats
+#endif
+
 namespace ostream_operators {
 
 template <class Char, class Traits, typename E, typename D = detail::enable_if_enum_t<E>>
 std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, E value) {
   static_assert(detail::check_enum_v<E, D>, "magic_enum::ostream_operators::operator<< requires enum type.");
 
-  if (auto name = detail::name_impl<D>(value); !name.empty()) {
-    for (auto c : name) {
-      os.put(c);
+  if (auto name = enum_name(value); !name.empty()) {
+    if constexpr (std::is_same_v<Char, char> && std::is_same_v<Traits, std::char_traits<char>>) {
+      os << name; // One formatted write, respects width and fill.
+    } else {
+      // Widened into buffer, so name is written by one formatted write too, which respects width and fill.
+      Char buffer[detail::max_name_length_v<D> > 0 ? detail::max_name_length_v<D> : 1];
+      for (std::size_t i = 0; i < name.size(); ++i) {
+        buffer[i] = os.widen(name[i]);
+      }
+      os << std::basic_string_view<Char, Traits>{buffer, name.size()};
     }
   } else {
     os << static_cast<std::underlying_type_t<D>>(value);
@@ -402,6 +799,106 @@ std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& o
 
 } // namespace magic_enum::ostream_operators
 
+namespace istream_operators {
+
+// Reads string enum name, or integer value if the next character is a digit or a sign, directly from the stream buffer.
+// Sets failbit and does not modify value if there is no string enum name or enum value with such integer value.
+template <class Char, class Traits, typename E, typename D = detail::enable_if_enum_t<E>>
+std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& is, E& value) {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::istream_operators::operator>> requires enum type.");
+  using U = std::underlying_type_t<D>;
+  using I = std::conditional_t<std::is_signed_v<U>, long long, unsigned long long>;
+
+  typename std::basic_istream<Char, Traits>::sentry sentry{is};
+  if (!sentry) {
+    return is;
+  }
+
+  // Enough for the longest name plus one character to detect longer words, or for sign and digits of integer.
+  constexpr auto size = (detail::max_name_length_v<D> > std::numeric_limits<I>::digits10 + 2 ? detail::max_name_length_v<D> : std::numeric_limits<I>::digits10 + 2) + 1;
+  char buffer[size];
+  std::size_t length = 0;
+  auto* rdbuf = is.rdbuf();
+  using stream = std::basic_istream<Char, Traits>;
+  auto state = stream::goodbit;
+
+  auto next = [&]() -> char {
+    auto c = rdbuf->sgetc();
+    if (Traits::eq_int_type(c, Traits::eof())) {
+      state |= stream::eofbit;
+      return '\0';
+    }
+    auto code = static_cast<std::make_unsigned_t<Char>>(Traits::to_char_type(c));
+    return code < 128 ? static_cast<char>(code) : '\0'; // Enum names consist of ASCII characters.
+  };
+  auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+  auto is_name = [&](char c) { return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; };
+
+  auto c = next();
+  std::optional<D> result;
+  if (is_digit(c) || c == '-' || c == '+') {
+    if (c == '-') {
+      buffer[length++] = c;
+    }
+    if (c == '-' || c == '+') {
+      rdbuf->sbumpc();
+      c = next();
+    }
+    // Leading zeros are skipped, so zero-padded numbers of any length fit into buffer.
+    bool zero = false;
+    while (c == '0') {
+      zero = true;
+      rdbuf->sbumpc();
+      c = next();
+    }
+    // All digits are consumed, number which does not fit into buffer is out of range of any integer type.
+    bool overflow = false;
+    while (is_digit(c)) {
+      if (length < size) {
+        buffer[length++] = c;
+      } else {
+        overflow = true;
+      }
+      rdbuf->sbumpc();
+      c = next();
+    }
+    if (zero && (length == 0 || (length == 1 && buffer[0] == '-'))) {
+      buffer[length++] = '0';
+    }
+
+    I integer = 0;
+    if (auto [ptr, ec] = std::from_chars(buffer, buffer + length, integer); !overflow && ec == std::errc{} && ptr == buffer + length) {
+      bool in_range = integer <= static_cast<I>((std::numeric_limits<U>::max)());
+      if constexpr (std::is_signed_v<U>) {
+        in_range = in_range && integer >= static_cast<I>((std::numeric_limits<U>::min)());
+      }
+      if (in_range) {
+        result = enum_cast<D>(static_cast<U>(integer));
+      }
+    }
+  } else {
+    while (is_name(c) && length < size) {
+      buffer[length++] = c;
+      rdbuf->sbumpc();
+      c = next();
+    }
+    if (length > 0 && length <= detail::max_name_length_v<D>) {
+      result = enum_cast<D>(std::string_view{buffer, length});
+    }
+  }
+
+  if (result.has_value()) {
+    value = result.value();
+  } else {
+    state |= stream::failbit;
+  }
+  is.setstate(state);
+
+  return is;
+}
+
+} // namespace magic_enum::istream_operators
+
 namespace bitwise_operators {
 
 template <typename E, typename D = detail::enable_if_enum_t<E>>
@@ -461,4 +958,6 @@ constexpr E& operator^=(E& lhs, E rhs) {
 
 } // namespace magic_enum
 
+#undef MAGIC_ENUM_STATS_RESULT
+
 #endif // NEARGYE_MAGIC_ENUM_HPP
@@ -0,0 +1,215 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_ATOMIC_HPP
+#define NEARGYE_MAGIC_ENUM_ATOMIC_HPP
+
+#include "magic_enum.hpp"
+#include "magic_enum_containers.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace magic_enum {
+
+namespace detail {
+
+inline constexpr std::size_t cache_line_size = 64;
+
+// Returns small number, unique for each thread, assigned on first call in the thread.
+[[nodiscard]] inline std::size_t thread_shard_hint() noexcept {
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t hint = next.fetch_add(1, std::memory_order_relaxed);
+
+  return hint;
+}
+
+} // namespace magic_enum::detail
+
+// Set of enum values stored as one bit for each enum value, in std::atomic<std::uint64_t> words.
+// Each operation on a single enum value is one atomic read-modify-write of one word, so enums with up to 64 values are
+// lock-free as a whole. For larger enums snapshot() and store() are performed word by word and are not atomic as a whole.
+template <typename E>
+class atomic_enum_bitset {
+  static_assert(std::is_enum_v<E>, "magic_enum::atomic_enum_bitset requires enum type.");
+
+  using bitset_type = enum_bitset<E>;
+  using words_type = typename bitset_type::words_type;
+
+  static constexpr std::size_t bits_per_word = 64;
+  static constexpr std::size_t num_words = std::tuple_size_v<words_type>;
+
+ public:
+  static constexpr bool is_always_lock_free = std::atomic<std::uint64_t>::is_always_lock_free;
+
+  constexpr atomic_enum_bitset() noexcept = default;
+
+  explicit atomic_enum_bitset(const bitset_type& values) noexcept {
+    store(values, std::memory_order_relaxed);
+  }
+
+  atomic_enum_bitset(const atomic_enum_bitset&) = delete;
+  atomic_enum_bitset& operator=(const atomic_enum_bitset&) = delete;
+
+  // Adds enum value to the set. Returns whether enum value was in the set before.
+  // Returns false and does nothing if value does not have name.
+  bool fetch_set(E value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      const auto bit = std::uint64_t{1} << (i % bits_per_word);
+      return (words_[i / bits_per_word].fetch_or(bit, order) & bit) != 0;
+    }
+
+    return false;
+  }
+
+  // Removes enum value from the set. Returns whether enum value was in the set before.
+  // Returns false and does nothing if value does not have name.
+  bool fetch_reset(E value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      const auto bit = std::uint64_t{1} << (i % bits_per_word);
+      return (words_[i / bits_per_word].fetch_and(~bit, order) & bit) != 0;
+    }
+
+    return false;
+  }
+
+  // Returns whether enum value is in the set. Returns false if value does not have name.
+  [[nodiscard]] bool test(E value, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      return ((words_[i / bits_per_word].load(order) >> (i % bits_per_word)) & 1) != 0;
+    }
+
+    return false;
+  }
+
+  // Returns copy of the set.
+  [[nodiscard]] bitset_type snapshot(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    words_type words{};
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words[i] = words_[i].load(order);
+    }
+
+    return bitset_type{words};
+  }
+
+  // Replaces the set.
+  void store(const bitset_type& values, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i].store(values.words()[i], order);
+    }
+  }
+
+  // Removes all enum values from the set.
+  void reset(std::memory_order order = std::memory_order_seq_cst) noexcept {
+    for (auto& w : words_) {
+      w.store(0, order);
+    }
+  }
+
+ private:
+  std::array<std::atomic<std::uint64_t>, num_words> words_{};
+};
+
+// Counters of enum values, split into Shards cache line aligned arrays of std::atomic<std::uint64_t>.
+// Each thread increments counters in its own shard with relaxed atomics, so threads do not share cache lines
+// while there are at most Shards threads. snapshot() sums counters of all shards.
+template <typename E, std::size_t Shards = 64>
+class enum_counter {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_counter requires enum type.");
+  static_assert(Shards > 0, "magic_enum::enum_counter requires Shards > 0.");
+
+  struct alignas(detail::cache_line_size) shard {
+    std::array<std::atomic<std::uint64_t>, detail::count_v<E>> counts{};
+  };
+
+ public:
+  using entry_type = std::tuple<E, std::string_view, std::uint64_t>;
+
+  enum_counter() noexcept = default;
+
+  enum_counter(const enum_counter&) = delete;
+  enum_counter& operator=(const enum_counter&) = delete;
+
+  // Adds n to counter of enum value. Does nothing if value does not have name.
+  void increment(E value, std::uint64_t n = 1) noexcept {
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      shards_[detail::thread_shard_hint() % Shards].counts[i].fetch_add(n, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns sum of counter of enum value over all shards. Returns 0 if value does not have name.
+  [[nodiscard]] std::uint64_t count(E value) const noexcept {
+    std::uint64_t n = 0;
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      for (const auto& s : shards_) {
+        n += s.counts[i].load(std::memory_order_relaxed);
+      }
+    }
+
+    return n;
+  }
+
+  // Returns std::array with std::tuple (value enum, string enum name, count), sorted by enum value.
+  // Increments concurrent with snapshot() may or may not be included.
+  [[nodiscard]] std::array<entry_type, detail::count_v<E>> snapshot() const noexcept {
+    std::array<entry_type, detail::count_v<E>> entries{};
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+      std::uint64_t n = 0;
+      for (const auto& s : shards_) {
+        n += s.counts[i].load(std::memory_order_relaxed);
+      }
+      entries[i] = {detail::entries_v<E>[i].first, detail::entries_v<E>[i].second, n};
+    }
+
+    return entries;
+  }
+
+  // Sets all counters to zero.
+  void reset() noexcept {
+    for (auto& s : shards_) {
+      for (auto& c : s.counts) {
+        c.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  std::array<shard, Shards> shards_{};
+};
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_ATOMIC_HPP
@@ -0,0 +1,291 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_BATCH_HPP
+#define NEARGYE_MAGIC_ENUM_BATCH_HPP
+
+#include "magic_enum.hpp"
+#include "magic_enum_dictionary.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Overloads with std::execution policies are available if the standard library supports parallel algorithms.
+// With libstdc++ parallel policies require linking TBB.
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+#if defined(__cpp_lib_execution)
+#  include <execution>
+#  include <functional>
+#  include <numeric>
+#endif
+
+namespace magic_enum {
+
+namespace detail {
+
+// Number of elements processed by one task of parallel batch conversion, so that input and output of task fit in L2 cache.
+template <typename In, typename Out>
+inline constexpr std::size_t batch_chunk_v = (64 * 1024) / (sizeof(In) + sizeof(Out)) > 0 ? (64 * 1024) / (sizeof(In) + sizeof(Out)) : 1;
+
+// Uses hash table of string enum names built at compile time, see magic_enum_dictionary.hpp.
+template <typename E>
+std::size_t cast_batch(const std::string_view* names, std::size_t first, std::size_t last, E* out) noexcept {
+  std::size_t invalid = 0;
+  for (auto i = first; i < last; ++i) {
+    if (auto index = dictionary_find<E>(names[i]); index < count_v<E>) {
+      out[i] = values_v<E>[index];
+    } else {
+      out[i] = E{};
+      ++invalid;
+    }
+  }
+
+  return invalid;
+}
+
+template <typename E>
+std::size_t name_batch(const E* values, std::size_t first, std::size_t last, std::string_view* out) noexcept {
+  std::size_t invalid = 0;
+  for (auto i = first; i < last; ++i) {
+    out[i] = enum_name(values[i]);
+    invalid += out[i].empty() ? 1 : 0;
+  }
+
+  return invalid;
+}
+
+template <typename E>
+std::size_t validate_batch(const E* values, std::size_t first, std::size_t last) noexcept {
+  std::size_t invalid = 0;
+  for (auto i = first; i < last; ++i) {
+    invalid += index_impl<E>(values[i]) < count_v<E> ? 0 : 1;
+  }
+
+  return invalid;
+}
+
+// Splits [0, n) into chunks, runs kernel(first, last) -> std::size_t for each chunk with executor, returns sum of results.
+template <std::size_t Chunk, typename Executor, typename Kernel>
+std::size_t run_batch(Executor&& executor, std::size_t n, Kernel kernel) {
+  const auto chunks = (n + Chunk - 1) / Chunk;
+  std::vector<std::size_t> results(chunks);
+  executor(chunks, [&](std::size_t chunk) {
+    const auto first = chunk * Chunk;
+    results[chunk] = kernel(first, first + Chunk < n ? first + Chunk : n);
+  });
+
+  std::size_t sum = 0;
+  for (auto r : results) {
+    sum += r;
+  }
+
+  return sum;
+}
+
+template <typename T>
+inline constexpr bool is_execution_policy_v =
+#if defined(__cpp_lib_execution)
+    std::is_execution_policy_v<remove_cvref_t<T>>;
+#else
+    false;
+#endif
+
+// Executor is callable as executor(chunks, task) and runs task(chunk) for each chunk in [0, chunks).
+template <typename T>
+inline constexpr bool is_batch_executor_v = !is_execution_policy_v<T> && std::is_invocable_v<T&, std::size_t, void (*)(std::size_t)>;
+
+template <typename T, typename R = void>
+using enable_if_executor_t = std::enable_if_t<is_batch_executor_v<T>, R>;
+
+// Joins started threads on scope exit, so exception from thread creation or task on calling thread does not call std::terminate.
+struct thread_joiner {
+  std::vector<std::thread>& threads;
+
+  ~thread_joiner() {
+    for (auto& t : threads) {
+      if (t.joinable()) {
+        t.join();
+      }
+    }
+  }
+};
+
+#if defined(__cpp_lib_execution)
+template <typename T, typename R = void>
+using enable_if_execution_policy_t = std::enable_if_t<is_execution_policy_v<T>, R>;
+
+template <std::size_t Chunk, typename ExecutionPolicy, typename Kernel>
+std::size_t run_batch_policy(ExecutionPolicy&& policy, std::size_t n, Kernel kernel) {
+  std::vector<std::size_t> firsts((n + Chunk - 1) / Chunk);
+  for (std::size_t i = 0; i < firsts.size(); ++i) {
+    firsts[i] = i * Chunk;
+  }
+
+  return std::transform_reduce(std::forward<ExecutionPolicy>(policy), firsts.begin(), firsts.end(), std::size_t{0}, std::plus<>{},
+                               [n, &kernel](std::size_t first) { return kernel(first, first + Chunk < n ? first + Chunk : n); });
+}
+#endif
+
+} // namespace magic_enum::detail
+
+// Executor for batch conversions, runs chunks on std::threads created for each call, calling thread included.
+// Threads take chunks from shared atomic counter, so uneven chunks do not stall other threads.
+class thread_executor {
+ public:
+  // threads = 0 means std::thread::hardware_concurrency().
+  explicit thread_executor(std::size_t threads = 0) noexcept
+      : threads_{threads > 0 ? threads : (std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1)} {}
+
+  [[nodiscard]] std::size_t threads() const noexcept { return threads_; }
+
+  template <typename Task>
+  void operator()(std::size_t chunks, Task&& task) const {
+    std::atomic<std::size_t> next{0};
+    auto work = [&]() {
+      for (auto chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < chunks; chunk = next.fetch_add(1, std::memory_order_relaxed)) {
+        task(chunk);
+      }
+    };
+
+    std::vector<std::thread> workers;
+    const detail::thread_joiner joiner{workers};
+    const auto n = threads_ < chunks ? threads_ : chunks;
+    workers.reserve(n);
+    for (std::size_t i = 1; i < n; ++i) {
+      workers.emplace_back(work);
+    }
+    work();
+  }
+
+ private:
+  std::size_t threads_;
+};
+
+// Converts string enum names[0..n) to enum values out[0..n), enum value of invalid name is value-initialized E{}.
+// Returns number of invalid names.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+std::size_t enum_cast_batch(const std::string_view* names, std::size_t n, D* out) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_cast_batch requires enum type.");
+
+  return detail::cast_batch<D>(names, 0, n, out);
+}
+
+// Same as enum_cast_batch(names, n, out), runs chunks of names with executor, e.g. thread_executor or adapter to thread pool.
+template <typename E, typename Executor, typename D = detail::enable_if_enum_t<E>>
+auto enum_cast_batch(Executor&& executor, const std::string_view* names, std::size_t n, D* out) -> detail::enable_if_executor_t<Executor, std::size_t> {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_cast_batch requires enum type.");
+
+  return detail::run_batch<detail::batch_chunk_v<std::string_view, D>>(executor, n, [=](std::size_t first, std::size_t last) {
+    return detail::cast_batch<D>(names, first, last, out);
+  });
+}
+
+// Writes string enum names of values[0..n) to out[0..n), name of value without name is empty.
+// Returns number of values without name.
+template <typename E>
+std::size_t enum_name_batch(const E* values, std::size_t n, std::string_view* out) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_name_batch requires enum type.");
+
+  return detail::name_batch<E>(values, 0, n, out);
+}
+
+// Same as enum_name_batch(values, n, out), runs chunks of values with executor.
+template <typename Executor, typename E>
+auto enum_name_batch(Executor&& executor, const E* values, std::size_t n, std::string_view* out) -> detail::enable_if_executor_t<Executor, std::size_t> {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_name_batch requires enum type.");
+
+  return detail::run_batch<detail::batch_chunk_v<E, std::string_view>>(executor, n, [=](std::size_t first, std::size_t last) {
+    return detail::name_batch<E>(values, first, last, out);
+  });
+}
+
+// Returns number of values[0..n) without name, e.g. decoded from untrusted integers.
+template <typename E>
+[[nodiscard]] std::size_t enum_validate_batch(const E* values, std::size_t n) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_validate_batch requires enum type.");
+
+  return detail::validate_batch<E>(values, 0, n);
+}
+
+// Same as enum_validate_batch(values, n), runs chunks of values with executor.
+template <typename Executor, typename E>
+[[nodiscard]] auto enum_validate_batch(Executor&& executor, const E* values, std::size_t n) -> detail::enable_if_executor_t<Executor, std::size_t> {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_validate_batch requires enum type.");
+
+  return detail::run_batch<detail::batch_chunk_v<E, char>>(executor, n, [=](std::size_t first, std::size_t last) {
+    return detail::validate_batch<E>(values, first, last);
+  });
+}
+
+#if defined(__cpp_lib_execution)
+// Same as enum_cast_batch(names, n, out), runs chunks of names with std::execution policy.
+template <typename E, typename ExecutionPolicy, typename D = detail::enable_if_enum_t<E>>
+auto enum_cast_batch(ExecutionPolicy&& policy, const std::string_view* names, std::size_t n, D* out) -> detail::enable_if_execution_policy_t<ExecutionPolicy, std::size_t> {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_cast_batch requires enum type.");
+
+  return detail::run_batch_policy<detail::batch_chunk_v<std::string_view, D>>(std::forward<ExecutionPolicy>(policy), n, [=](std::size_t first, std::size_t last) {
+    return detail::cast_batch<D>(names, first, last, out);
+  });
+}
+
+// Same as enum_name_batch(values, n, out), runs chunks of values with std::execution policy.
+template <typename ExecutionPolicy, typename E>
+auto enum_name_batch(ExecutionPolicy&& policy, const E* values, std::size_t n, std::string_view* out) -> detail::enable_if_execution_policy_t<ExecutionPolicy, std::size_t> {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_name_batch requires enum type.");
+
+  return detail::run_batch_policy<detail::batch_chunk_v<E, std::string_view>>(std::forward<ExecutionPolicy>(policy), n, [=](std::size_t first, std::size_t last) {
+    return detail::name_batch<E>(values, first, last, out);
+  });
+}
+
+// Same as enum_validate_batch(values, n), runs chunks of values with std::execution policy.
+template <typename ExecutionPolicy, typename E>
+[[nodiscard]] auto enum_validate_batch(ExecutionPolicy&& policy, const E* values, std::size_t n) -> detail::enable_if_execution_policy_t<ExecutionPolicy, std::size_t> {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_validate_batch requires enum type.");
+
+  return detail::run_batch_policy<detail::batch_chunk_v<E, char>>(std::forward<ExecutionPolicy>(policy), n, [=](std::size_t first, std::size_t last) {
+    return detail::validate_batch<E>(values, first, last);
+  });
+}
+#endif
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_BATCH_HPP
@@ -0,0 +1,149 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_BINARY_HPP
+#define NEARGYE_MAGIC_ENUM_BINARY_HPP
+
+#include "magic_enum.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace magic_enum {
+
+namespace detail {
+
+template <typename E>
+[[nodiscard]] constexpr std::uint64_t fingerprint_impl() noexcept {
+  // Number of values, then for each value: 8 bytes of integer value (little-endian), string enum name and separator.
+  auto hash = hash_fnv1a({}) ^ count_v<E>;
+  for (const auto& [value, name] : entries_v<E>) {
+    const auto integer = static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+    for (int i = 0; i < 8; ++i) {
+      hash = (hash ^ ((integer >> (8 * i)) & 0xFF)) * 1099511628211ULL;
+    }
+    hash = hash_fnv1a(name, hash);
+    hash = hash_fnv1a({"\0", 1}, hash);
+  }
+
+  return hash;
+}
+
+template <typename E>
+inline constexpr std::uint64_t fingerprint_v = fingerprint_impl<E>();
+
+} // namespace magic_enum::detail
+
+// Smallest unsigned integer type, which holds index of each value of enum type E.
+template <typename E>
+using enum_code_t = std::conditional_t<(detail::count_v<E> <= (std::numeric_limits<std::uint8_t>::max)() + std::size_t{1}), std::uint8_t,
+                    std::conditional_t<(detail::count_v<E> <= (std::numeric_limits<std::uint16_t>::max)() + std::size_t{1}), std::uint16_t, std::uint32_t>>;
+
+// Returns 64-bit fingerprint of enum schema, hashed from enum values and string enum names.
+// Fingerprints differ if values are added, removed, renamed or renumbered.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::uint64_t enum_fingerprint() noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_fingerprint requires enum type.");
+
+  return detail::fingerprint_v<D>;
+}
+
+// Obtains code of enum value, its index in enum value sequence.
+// Returns std::optional with code, or std::nullopt if value does not have name.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::optional<enum_code_t<D>> enum_encode(E value) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_encode requires enum type.");
+
+  if (auto i = detail::index_impl<D>(value); i < detail::count_v<D>) {
+    return static_cast<enum_code_t<D>>(i);
+  }
+
+  return std::nullopt; // Invalid value or out of range.
+}
+
+// Obtains enum value from code.
+// Returns std::optional with enum value, or std::nullopt if code is not less than number of enum values.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::optional<D> enum_decode(std::uint64_t code) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_decode requires enum type.");
+
+  if (code < detail::count_v<D>) {
+    return detail::values_v<D>[static_cast<std::size_t>(code)];
+  }
+
+  return std::nullopt; // Invalid code.
+}
+
+// Writes code of enum value as sizeof(enum_code_t<E>) bytes, little-endian.
+// Returns pointer one past the last written byte, or nullptr and writes nothing if value does not have name.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr unsigned char* enum_encode(E value, unsigned char* out) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_encode requires enum type.");
+
+  if (auto code = enum_encode(value); code.has_value()) {
+    for (std::size_t i = 0; i < sizeof(enum_code_t<D>); ++i) {
+      *out++ = static_cast<unsigned char>((*code >> (8 * i)) & 0xFF);
+    }
+
+    return out;
+  }
+
+  return nullptr; // Invalid value or out of range.
+}
+
+// Reads code of enum value written by enum_encode(value, out) at cursor.
+// Returns std::optional with enum value and moves cursor past the code,
+// or std::nullopt and does not move cursor if there are not enough bytes or code is invalid.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::optional<D> enum_decode(const unsigned char*& cursor, const unsigned char* last) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::enum_decode requires enum type.");
+
+  if (static_cast<std::size_t>(last - cursor) < sizeof(enum_code_t<D>)) {
+    return std::nullopt;
+  }
+  std::uint64_t code = 0;
+  for (std::size_t i = 0; i < sizeof(enum_code_t<D>); ++i) {
+    code |= static_cast<std::uint64_t>(cursor[i]) << (8 * i);
+  }
+  auto value = enum_decode<D>(code);
+  if (value.has_value()) {
+    cursor += sizeof(enum_code_t<D>);
+  }
+
+  return value;
+}
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_BINARY_HPP
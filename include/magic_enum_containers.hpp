@@ -0,0 +1,646 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_CONTAINERS_HPP
+#define NEARGYE_MAGIC_ENUM_CONTAINERS_HPP
+
+#include "magic_enum.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace magic_enum {
+
+namespace detail {
+
+template <typename E, typename A, typename R>
+class enum_array_iterator final {
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = std::pair<E, R&>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = value_type;
+
+  constexpr enum_array_iterator(A* array, std::size_t index) noexcept : array_{array}, index_{index} {}
+
+  [[nodiscard]] constexpr reference operator*() const noexcept { return {values_v<E>[index_], array_->a[index_]}; }
+
+  constexpr enum_array_iterator& operator++() noexcept { return ++index_, *this; }
+
+  constexpr enum_array_iterator operator++(int) noexcept { auto it = *this; ++index_; return it; }
+
+  [[nodiscard]] constexpr bool operator==(const enum_array_iterator& rhs) const noexcept { return index_ == rhs.index_; }
+
+  [[nodiscard]] constexpr bool operator!=(const enum_array_iterator& rhs) const noexcept { return index_ != rhs.index_; }
+
+ private:
+  A* array_;
+  std::size_t index_;
+};
+
+[[nodiscard]] constexpr int countr_zero(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(x);
+#else
+  int n = 0;
+  for (; (x & 1) == 0; x >>= 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+[[nodiscard]] constexpr std::size_t popcount(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+  std::size_t n = 0;
+  for (; x != 0; x &= x - 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+template <typename E>
+class enum_bitset_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = E;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const E*;
+  using reference = E;
+
+  constexpr enum_bitset_iterator(const std::uint64_t* words, std::size_t size, std::size_t index) noexcept
+      : words_{words}, size_{size}, index_{index}, word_{index < size ? words[index] : 0} {
+    skip();
+  }
+
+  [[nodiscard]] constexpr reference operator*() const noexcept {
+    return values_v<E>[index_ * 64 + static_cast<std::size_t>(countr_zero(word_))];
+  }
+
+  constexpr enum_bitset_iterator& operator++() noexcept {
+    word_ &= word_ - 1;
+    skip();
+    return *this;
+  }
+
+  constexpr enum_bitset_iterator operator++(int) noexcept { auto it = *this; ++*this; return it; }
+
+  [[nodiscard]] constexpr bool operator==(const enum_bitset_iterator& rhs) const noexcept { return index_ == rhs.index_ && word_ == rhs.word_; }
+
+  [[nodiscard]] constexpr bool operator!=(const enum_bitset_iterator& rhs) const noexcept { return !(*this == rhs); }
+
+ private:
+  constexpr void skip() noexcept {
+    while (word_ == 0 && index_ < size_) {
+      if (++index_ < size_) {
+        word_ = words_[index_];
+      }
+    }
+  }
+
+  const std::uint64_t* words_;
+  std::size_t size_;
+  std::size_t index_;
+  std::uint64_t word_;
+};
+
+template <typename E>
+[[nodiscard]] constexpr std::size_t index_bits() noexcept {
+  std::size_t bits = 1;
+  while (bits < 64 && (std::uint64_t{1} << bits) < count_v<E>) {
+    ++bits;
+  }
+
+  return bits;
+}
+
+// Whether values_v<E> is a run of consecutive integers, so index of value is value - values_v<E>[0].
+template <typename E>
+[[nodiscard]] constexpr bool is_contiguous() noexcept {
+  constexpr auto values = values_v<E>;
+
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    if (static_cast<long long>(values[i]) - static_cast<long long>(values[i - 1]) != 1) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename E>
+inline constexpr bool is_contiguous_v = is_contiguous<E>();
+
+template <typename E>
+[[nodiscard]] constexpr E value_at(std::size_t index) noexcept {
+  if constexpr (is_contiguous_v<E> && count_v<E> > 0) {
+    return static_cast<E>(static_cast<std::underlying_type_t<E>>(index) + static_cast<std::underlying_type_t<E>>(values_v<E>[0]));
+  } else {
+    return values_v<E>[index];
+  }
+}
+
+} // namespace magic_enum::detail
+
+// Fixed-size array of T with one element for each enum value, indexed by enum value.
+// Elements are stored contiguously in order of enum_values<E>(), iteration yields std::pair (enum value, reference to element).
+template <typename E, typename T>
+struct enum_array {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_array requires enum type.");
+
+  using container_type = std::array<T, detail::count_v<E>>;
+  using key_type = E;
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = detail::enum_array_iterator<E, enum_array, T>;
+  using const_iterator = detail::enum_array_iterator<E, const enum_array, const T>;
+
+  // Returns reference to element of enum value.
+  // No bounds checking is performed: the behavior is undefined if value does not have name.
+  [[nodiscard]] constexpr reference operator[](E value) noexcept {
+    return assert(detail::index_impl<E>(value) < a.size()), a[detail::index_impl<E>(value)];
+  }
+
+  [[nodiscard]] constexpr const_reference operator[](E value) const noexcept {
+    return assert(detail::index_impl<E>(value) < a.size()), a[detail::index_impl<E>(value)];
+  }
+
+  // Returns pointer to element of enum value, or nullptr if value does not have name.
+  [[nodiscard]] constexpr T* find(E value) noexcept {
+    auto i = detail::index_impl<E>(value);
+    return i < a.size() ? &a[i] : nullptr;
+  }
+
+  [[nodiscard]] constexpr const T* find(E value) const noexcept {
+    auto i = detail::index_impl<E>(value);
+    return i < a.size() ? &a[i] : nullptr;
+  }
+
+  [[nodiscard]] constexpr T* data() noexcept { return a.data(); }
+
+  [[nodiscard]] constexpr const T* data() const noexcept { return a.data(); }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return a.size(); }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return a.empty(); }
+
+  constexpr void fill(const T& value) {
+    for (auto& e : a) {
+      e = value;
+    }
+  }
+
+  [[nodiscard]] constexpr iterator begin() noexcept { return {this, 0}; }
+
+  [[nodiscard]] constexpr iterator end() noexcept { return {this, a.size()}; }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return {this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return {this, a.size()}; }
+
+  [[nodiscard]] friend constexpr bool operator==(const enum_array& lhs, const enum_array& rhs) {
+    for (std::size_t i = 0; i < lhs.a.size(); ++i) {
+      if (!(lhs.a[i] == rhs.a[i])) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] friend constexpr bool operator!=(const enum_array& lhs, const enum_array& rhs) { return !(lhs == rhs); }
+
+  container_type a;
+};
+
+// Set of enum values stored as one bit for each enum value, in machine words of 64 bits.
+// Bit i corresponds to enum_value<E>(i), iteration yields the contained enum values sorted by enum value.
+template <typename E>
+class enum_bitset {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_bitset requires enum type.");
+
+  static constexpr std::size_t bits_per_word = 64;
+  static constexpr std::size_t num_words = (detail::count_v<E> + bits_per_word - 1) / bits_per_word;
+  static constexpr std::uint64_t last_word_mask = detail::count_v<E> % bits_per_word == 0
+                                                      ? ~std::uint64_t{0}
+                                                      : (std::uint64_t{1} << (detail::count_v<E> % bits_per_word)) - 1;
+
+ public:
+  using key_type = E;
+  using value_type = E;
+  using size_type = std::size_t;
+  using iterator = detail::enum_bitset_iterator<E>;
+  using const_iterator = iterator;
+  using words_type = std::array<std::uint64_t, num_words>;
+
+  constexpr enum_bitset() noexcept = default;
+
+  // Constructs from machine words, bits of unused tail of the last word are ignored.
+  explicit constexpr enum_bitset(const words_type& words) noexcept : words_{words} {
+    if constexpr (num_words > 0) {
+      words_[num_words - 1] &= last_word_mask;
+    }
+  }
+
+  constexpr enum_bitset(std::initializer_list<E> values) noexcept {
+    for (auto value : values) {
+      set(value);
+    }
+  }
+
+  // Returns whether enum value is in the set. Returns false if value does not have name.
+  [[nodiscard]] constexpr bool test(E value) const noexcept {
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      return (words_[i / bits_per_word] >> (i % bits_per_word)) & 1;
+    }
+
+    return false;
+  }
+
+  // Adds (or removes if flag is false) enum value to the set. Does nothing if value does not have name.
+  constexpr enum_bitset& set(E value, bool flag = true) noexcept {
+    if (auto i = detail::index_impl<E>(value); i < detail::count_v<E>) {
+      const auto bit = std::uint64_t{1} << (i % bits_per_word);
+      words_[i / bits_per_word] = flag ? (words_[i / bits_per_word] | bit) : (words_[i / bits_per_word] & ~bit);
+    }
+
+    return *this;
+  }
+
+  // Adds all enum values to the set.
+  constexpr enum_bitset& set() noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i] = i + 1 == num_words ? last_word_mask : ~std::uint64_t{0};
+    }
+
+    return *this;
+  }
+
+  constexpr enum_bitset& reset(E value) noexcept { return set(value, false); }
+
+  constexpr enum_bitset& reset() noexcept {
+    for (auto& w : words_) {
+      w = 0;
+    }
+
+    return *this;
+  }
+
+  constexpr enum_bitset& flip(E value) noexcept { return set(value, !test(value)); }
+
+  constexpr enum_bitset& flip() noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i] = ~words_[i] & (i + 1 == num_words ? last_word_mask : ~std::uint64_t{0});
+    }
+
+    return *this;
+  }
+
+  // Returns number of enum values in the set.
+  [[nodiscard]] constexpr size_type count() const noexcept {
+    size_type n = 0;
+    for (auto w : words_) {
+      n += detail::popcount(w);
+    }
+
+    return n;
+  }
+
+  // Returns number of enum values, which can be stored in the set.
+  [[nodiscard]] static constexpr size_type size() noexcept { return detail::count_v<E>; }
+
+  [[nodiscard]] constexpr bool any() const noexcept {
+    for (auto w : words_) {
+      if (w != 0) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+
+  [[nodiscard]] constexpr bool all() const noexcept { return count() == size(); }
+
+  [[nodiscard]] constexpr iterator begin() const noexcept { return {words_.data(), num_words, 0}; }
+
+  [[nodiscard]] constexpr iterator end() const noexcept { return {words_.data(), num_words, num_words}; }
+
+  // Returns machine words of the set, bits of unused tail of the last word are always zero.
+  [[nodiscard]] constexpr const words_type& words() const noexcept { return words_; }
+
+  // Returns string with names of enum values in the set joined by separator, sorted by enum value.
+  [[nodiscard]] std::string to_string(std::string_view separator = "|") const {
+    std::string result;
+    for (auto value : *this) {
+      if (!result.empty()) {
+        result.append(separator);
+      }
+      result.append(detail::names_v<E>[detail::index_impl<E>(value)]);
+    }
+
+    return result;
+  }
+
+  constexpr enum_bitset& operator|=(const enum_bitset& rhs) noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i] |= rhs.words_[i];
+    }
+
+    return *this;
+  }
+
+  constexpr enum_bitset& operator&=(const enum_bitset& rhs) noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i] &= rhs.words_[i];
+    }
+
+    return *this;
+  }
+
+  constexpr enum_bitset& operator^=(const enum_bitset& rhs) noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i] ^= rhs.words_[i];
+    }
+
+    return *this;
+  }
+
+  // Set difference: removes enum values, which are in rhs.
+  constexpr enum_bitset& operator-=(const enum_bitset& rhs) noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i] &= ~rhs.words_[i];
+    }
+
+    return *this;
+  }
+
+  [[nodiscard]] constexpr enum_bitset operator~() const noexcept { return enum_bitset{*this}.flip(); }
+
+  [[nodiscard]] friend constexpr enum_bitset operator|(enum_bitset lhs, const enum_bitset& rhs) noexcept { return lhs |= rhs; }
+
+  [[nodiscard]] friend constexpr enum_bitset operator&(enum_bitset lhs, const enum_bitset& rhs) noexcept { return lhs &= rhs; }
+
+  [[nodiscard]] friend constexpr enum_bitset operator^(enum_bitset lhs, const enum_bitset& rhs) noexcept { return lhs ^= rhs; }
+
+  [[nodiscard]] friend constexpr enum_bitset operator-(enum_bitset lhs, const enum_bitset& rhs) noexcept { return lhs -= rhs; }
+
+  [[nodiscard]] friend constexpr bool operator==(const enum_bitset& lhs, const enum_bitset& rhs) noexcept {
+    for (std::size_t i = 0; i < num_words; ++i) {
+      if (lhs.words_[i] != rhs.words_[i]) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] friend constexpr bool operator!=(const enum_bitset& lhs, const enum_bitset& rhs) noexcept { return !(lhs == rhs); }
+
+ private:
+  words_type words_{};
+};
+
+// Sequence of enum values stored as indexes in enum value sequence, with bits_per_value = ceil(log2(enum_count<E>())) bits each.
+// Values are packed into 64-bit words, values_per_word = 64 / bits_per_value, a value never spans two words.
+template <typename E>
+class packed_enum_vector {
+  static_assert(std::is_enum_v<E>, "magic_enum::packed_enum_vector requires enum type.");
+  static_assert(detail::count_v<E> > 0, "magic_enum::packed_enum_vector requires enum with values.");
+
+ public:
+  using value_type = E;
+  using size_type = std::size_t;
+
+  static constexpr size_type bits_per_value = detail::index_bits<E>();
+  static constexpr size_type values_per_word = 64 / bits_per_value;
+
+  packed_enum_vector() = default;
+
+  // Constructs vector with n copies of value.
+  explicit packed_enum_vector(size_type n, E value = detail::values_v<E>[0]) {
+    resize(n, value);
+  }
+
+  // Returns enum value at position i.
+  // No bounds checking is performed: the behavior is undefined if i >= size().
+  [[nodiscard]] E operator[](size_type i) const noexcept {
+    assert(i < size_);
+    return detail::value_at<E>(static_cast<std::size_t>((words_[i / values_per_word] >> shift(i)) & mask));
+  }
+
+  // Replaces enum value at position i.
+  // No bounds checking is performed: the behavior is undefined if i >= size() or value does not have name, see try_set.
+  void set(size_type i, E value) noexcept {
+    assert(i < size_);
+    assert(detail::index_impl<E>(value) < detail::count_v<E>);
+    auto& w = words_[i / values_per_word];
+    w = (w & ~(mask << shift(i))) | (encode(value) << shift(i));
+  }
+
+  // Replaces enum value at position i.
+  // No bounds checking is performed: the behavior is undefined if i >= size().
+  // Returns false and does nothing if value does not have name.
+  [[nodiscard]] bool try_set(size_type i, E value) noexcept {
+    if (detail::index_impl<E>(value) < detail::count_v<E>) {
+      set(i, value);
+      return true;
+    }
+
+    return false;
+  }
+
+  void push_back(E value) {
+    if (size_ % values_per_word == 0) {
+      words_.push_back(0);
+    }
+    ++size_;
+    set(size_ - 1, value);
+  }
+
+  // Appends enum value. Returns false and does nothing if value does not have name.
+  [[nodiscard]] bool try_push_back(E value) {
+    if (detail::index_impl<E>(value) < detail::count_v<E>) {
+      push_back(value);
+      return true;
+    }
+
+    return false;
+  }
+
+  // Appends n enum values from first.
+  // Returns false and appends nothing if any value does not have name, e.g. decoded from untrusted integers.
+  [[nodiscard]] bool try_pack(const E* first, size_type n) {
+    if (valid(first, n)) {
+      pack(first, n);
+      return true;
+    }
+
+    return false;
+  }
+
+  // Appends n enum values from first.
+  // The behavior is undefined if any value does not have name, see try_pack.
+  void pack(const E* first, size_type n) {
+    assert(valid(first, n)); // Checked once before packing, check inside loop prevents vectorization.
+    size_type i = 0;
+    for (; i < n && size_ % values_per_word != 0; ++i) {
+      push_back(first[i]);
+    }
+
+    // Whole words, inner loop has constant trip count and no dependency between iterations.
+    const size_type whole = (n - i) / values_per_word;
+    words_.resize(words_.size() + whole);
+    auto* out = words_.data() + words_.size() - whole;
+    for (size_type w = 0; w < whole; ++w, i += values_per_word) {
+      std::uint64_t word = 0;
+      for (size_type j = 0; j < values_per_word; ++j) {
+        word |= encode(first[i + j]) << (j * bits_per_value);
+      }
+      out[w] = word;
+    }
+    size_ += whole * values_per_word;
+
+    for (; i < n; ++i) {
+      push_back(first[i]);
+    }
+  }
+
+  // Copies n enum values starting from position pos to out.
+  // No bounds checking is performed: the behavior is undefined if pos + n > size().
+  void unpack(size_type pos, size_type n, E* out) const noexcept {
+    assert(pos + n <= size_);
+    size_type i = 0;
+    for (; i < n && (pos + i) % values_per_word != 0; ++i) {
+      out[i] = (*this)[pos + i];
+    }
+
+    // Whole words, inner loop has constant trip count and no dependency between iterations.
+    for (; n - i >= values_per_word; i += values_per_word) {
+      const auto word = words_[(pos + i) / values_per_word];
+      for (size_type j = 0; j < values_per_word; ++j) {
+        out[i + j] = decode(static_cast<decode_index_t>((word >> (j * bits_per_value)) & mask));
+      }
+    }
+
+    // Tail is shorter than word, explicit bound lets compiler see that index does not overflow.
+    const size_type tail = (n - i) % values_per_word;
+    for (size_type j = 0; j < tail; ++j) {
+      out[i + j] = (*this)[pos + i + j];
+    }
+  }
+
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  void reserve(size_type n) { words_.reserve((n + values_per_word - 1) / values_per_word); }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void resize(size_type n, E value = detail::values_v<E>[0]) {
+    const auto old_size = size_;
+    words_.resize((n + values_per_word - 1) / values_per_word);
+    size_ = n;
+    for (auto i = old_size; i < n; ++i) {
+      set(i, value);
+    }
+  }
+
+  // Returns packed storage, values_per_word indexes of bits_per_value bits in each word, from the least significant bits.
+  [[nodiscard]] const std::vector<std::uint64_t>& words() const noexcept { return words_; }
+
+ private:
+  static constexpr std::uint64_t mask = bits_per_value == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits_per_value) - 1;
+
+  [[nodiscard]] static constexpr size_type shift(size_type i) noexcept { return (i % values_per_word) * bits_per_value; }
+
+  // Returns index of value without range check, value must have name.
+  [[nodiscard]] static constexpr std::uint64_t encode(E value) noexcept {
+    if constexpr (detail::is_contiguous_v<E>) {
+      return static_cast<std::uint64_t>(static_cast<long long>(value) - static_cast<long long>(detail::values_v<E>[0]));
+    } else {
+      return static_cast<std::uint64_t>(detail::indexes_v<E>[static_cast<std::size_t>(static_cast<long long>(value) - detail::min_v<E>)]);
+    }
+  }
+
+  // Lookup in sparse values uses 32-bit index, so it can be vectorized as gather.
+  using decode_index_t = std::conditional_t<detail::is_contiguous_v<E>, std::size_t, std::uint32_t>;
+
+  [[nodiscard]] static constexpr E decode(decode_index_t index) noexcept {
+    if constexpr (detail::is_contiguous_v<E>) {
+      return detail::value_at<E>(index);
+    } else {
+      return detail::values_v<E>[index];
+    }
+  }
+
+  // Max reduction without early exit, so check can be vectorized too.
+  [[nodiscard]] static constexpr bool valid(const E* first, size_type n) noexcept {
+    std::uint64_t max_index = 0;
+    for (size_type i = 0; i < n; ++i) {
+      if constexpr (detail::is_contiguous_v<E>) {
+        max_index = (std::max)(max_index, encode(first[i]));
+      } else {
+        max_index = (std::max)(max_index, static_cast<std::uint64_t>(detail::index_impl<E>(first[i])));
+      }
+    }
+
+    return max_index < detail::count_v<E>;
+  }
+
+  std::vector<std::uint64_t> words_;
+  size_type size_ = 0;
+};
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_CONTAINERS_HPP
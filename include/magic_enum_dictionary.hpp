@@ -0,0 +1,166 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_DICTIONARY_HPP
+#define NEARGYE_MAGIC_ENUM_DICTIONARY_HPP
+
+#include "magic_enum.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace magic_enum {
+
+namespace detail {
+
+// Number of slots of open addressing hash table of string enum names, power of two, at least twice the number of enum values.
+template <typename E>
+[[nodiscard]] constexpr std::size_t dictionary_slots() noexcept {
+  std::size_t slots = 1;
+  while (slots < 2 * count_v<E>) {
+    slots *= 2;
+  }
+
+  return slots;
+}
+
+// Open addressing hash table with linear probing, slot contains index in enum value sequence or invalid_index_v<E>.
+template <typename E>
+[[nodiscard]] constexpr auto dictionary_index_impl() noexcept {
+  std::array<index_t<E>, dictionary_slots<E>()> slots{};
+  for (auto& s : slots) {
+    s = invalid_index_v<E>;
+  }
+
+  for (std::size_t i = 0; i < count_v<E>; ++i) {
+    auto h = static_cast<std::size_t>(hash_fnv1a(names_v<E>[i])) & (slots.size() - 1);
+    while (slots[h] != invalid_index_v<E>) {
+      h = (h + 1) & (slots.size() - 1);
+    }
+    slots[h] = static_cast<index_t<E>>(i);
+  }
+
+  return slots;
+}
+
+template <typename E>
+inline constexpr auto dictionary_index_v = dictionary_index_impl<E>();
+
+// Returns index of string enum name in enum value sequence, or count_v<E> if there is no such name.
+template <typename E>
+[[nodiscard]] constexpr std::size_t dictionary_find(std::string_view name) noexcept {
+  constexpr auto mask = dictionary_index_v<E>.size() - 1;
+
+  for (auto h = static_cast<std::size_t>(hash_fnv1a(name)) & mask; dictionary_index_v<E>[h] != invalid_index_v<E>; h = (h + 1) & mask) {
+    if (names_v<E>[dictionary_index_v<E>[h]] == name) {
+      return dictionary_index_v<E>[h];
+    }
+  }
+
+  return count_v<E>;
+}
+
+} // namespace magic_enum::detail
+
+// Converts column of length strings in Arrow layout (offsets[0..length], characters of string i in data[offsets[i], offsets[i + 1]))
+// to enum values, using hash table of string enum names built at compile time.
+// Writes enum values to out_values[0..length), and validity of each row to out_invalid_bitmap[0..(length + 7) / 8) as bits
+// in least significant bit order, set if string is not string enum name. Enum value of invalid row is value-initialized E{}.
+// Returns number of invalid rows.
+template <typename E, typename Offset>
+std::size_t enum_dictionary_encode(const Offset* offsets, std::size_t length, const char* data, E* out_values, std::uint8_t* out_invalid_bitmap) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_dictionary_encode requires enum type.");
+  static_assert(std::is_integral_v<Offset>, "magic_enum::enum_dictionary_encode requires integral offsets.");
+  std::size_t invalid = 0;
+  std::uint8_t bits = 0;
+
+  for (std::size_t i = 0; i < length; ++i) {
+    const std::string_view name{data + offsets[i], static_cast<std::size_t>(offsets[i + 1] - offsets[i])};
+    if (auto index = detail::dictionary_find<E>(name); index < detail::count_v<E>) {
+      out_values[i] = detail::values_v<E>[index];
+    } else {
+      out_values[i] = E{};
+      bits |= static_cast<std::uint8_t>(1U << (i % 8));
+      ++invalid;
+    }
+    if (i % 8 == 7 || i + 1 == length) {
+      out_invalid_bitmap[i / 8] = bits;
+      bits = 0;
+    }
+  }
+
+  return invalid;
+}
+
+// Returns number of characters written by enum_dictionary_decode for values[0..length).
+template <typename E>
+[[nodiscard]] std::size_t enum_dictionary_decoded_size(const E* values, std::size_t length) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_dictionary_decoded_size requires enum type.");
+  std::size_t size = 0;
+
+  for (std::size_t i = 0; i < length; ++i) {
+    if (auto index = detail::index_impl<E>(values[i]); index < detail::count_v<E>) {
+      size += detail::names_v<E>[index].size();
+    }
+  }
+
+  return size;
+}
+
+// Converts enum values[0..length) to column of string enum names in Arrow layout, offsets start from zero.
+// Writes out_offsets[0..length] and enum_dictionary_decoded_size(values, length) characters to out_data.
+// Enum value without name is written as empty string.
+// Returns number of written characters.
+template <typename E, typename Offset>
+std::size_t enum_dictionary_decode(const E* values, std::size_t length, Offset* out_offsets, char* out_data) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_dictionary_decode requires enum type.");
+  static_assert(std::is_integral_v<Offset>, "magic_enum::enum_dictionary_decode requires integral offsets.");
+  std::size_t size = 0;
+
+  for (std::size_t i = 0; i < length; ++i) {
+    out_offsets[i] = static_cast<Offset>(size);
+    if (auto index = detail::index_impl<E>(values[i]); index < detail::count_v<E>) {
+      for (auto c : detail::names_v<E>[index]) {
+        out_data[size++] = c;
+      }
+    }
+  }
+  out_offsets[length] = static_cast<Offset>(size);
+
+  return size;
+}
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_DICTIONARY_HPP
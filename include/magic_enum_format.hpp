@@ -0,0 +1,167 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_FORMAT_HPP
+#define NEARGYE_MAGIC_ENUM_FORMAT_HPP
+
+#include "magic_enum.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+// std::formatter for enums is available if the standard library supports std::format (C++20), see enable_enum_format.
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+#if defined(__cpp_lib_format)
+#  include <format>
+#endif
+
+// Define MAGIC_ENUM_ENABLE_FMT before including this header to enable fmt::formatter for enums, see enable_enum_format.
+#if defined(MAGIC_ENUM_ENABLE_FMT)
+#  include <fmt/format.h>
+#endif
+
+namespace magic_enum {
+
+// std::formatter and fmt::formatter are enabled only for enum types, for which enable_enum_format is specialized as std::true_type,
+// so enum types of other libraries, which may have own formatter, are not affected.
+template <typename E>
+struct enable_enum_format : std::false_type {
+  static_assert(std::is_enum_v<E>, "magic_enum::enable_enum_format requires enum type.");
+};
+
+// Returns maximum number of characters, which formatter writes for enum value without width and fill:
+// the longest name, or integer in binary with sign and base prefix. Can be used to reserve output buffer.
+template <typename E>
+[[nodiscard]] constexpr std::size_t enum_format_max_size() noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::enum_format_max_size requires enum type.");
+  using U = std::underlying_type_t<E>;
+  constexpr auto integer = static_cast<std::size_t>(std::numeric_limits<U>::digits) + (std::is_signed_v<U> ? 2 : 0) + 2;
+
+  return detail::max_name_length_v<E> > integer ? detail::max_name_length_v<E> : integer;
+}
+
+} // namespace magic_enum
+
+namespace magic_enum::detail {
+
+// Returns presentation type of format spec in [first, last), which is the last character of spec outside of nested replacement fields.
+template <typename It>
+constexpr char enum_format_type(It first, It last) noexcept {
+  char type = '\0';
+  int depth = 0;
+  for (; first != last; ++first) {
+    if (*first == '{') {
+      ++depth;
+    } else if (*first == '}') {
+      if (depth == 0) {
+        break;
+      }
+      --depth;
+      type = '\0';
+    } else if (depth == 0) {
+      type = static_cast<char>(*first);
+    }
+  }
+
+  return type;
+}
+
+// Formatter of enum, spec is standard format spec of string for name, or of integer for presentation type d, x, X, b, B, o.
+// Enum value without name is formatted as decimal integer with spec of string, so fill, align and width are applied too.
+template <typename E, template <typename...> class Formatter>
+struct enum_formatter {
+  using U = std::underlying_type_t<E>;
+  using I = std::conditional_t<std::is_signed_v<U>, long long, unsigned long long>;
+
+  Formatter<std::string_view, char> name_formatter;
+  Formatter<I, char> integer_formatter;
+  bool integer = false;
+
+  template <typename ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    switch (enum_format_type(ctx.begin(), ctx.end())) {
+      case 'd':
+      case 'x':
+      case 'X':
+      case 'b':
+      case 'B':
+      case 'o':
+        integer = true;
+        return integer_formatter.parse(ctx);
+      default:
+        integer = false;
+        return name_formatter.parse(ctx);
+    }
+  }
+
+  template <typename FormatContext>
+  auto format(E value, FormatContext& ctx) const {
+    if (integer) {
+      return integer_formatter.format(static_cast<I>(value), ctx);
+    }
+    if (auto name = enum_name(value); !name.empty()) {
+      return name_formatter.format(name, ctx);
+    }
+
+    // Sign, decimal digits, fits because enum_format_max_size counts binary digits.
+    char buffer[enum_format_max_size<E>()];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<I>(value));
+
+    return name_formatter.format(std::string_view{buffer, static_cast<std::size_t>(result.ptr - buffer)}, ctx);
+  }
+};
+
+} // namespace magic_enum::detail
+
+#if defined(__cpp_lib_format)
+
+template <typename E>
+  requires std::is_enum_v<E> && magic_enum::enable_enum_format<E>::value
+struct std::formatter<E, char> : magic_enum::detail::enum_formatter<E, std::formatter> {};
+
+#endif
+
+#if defined(MAGIC_ENUM_ENABLE_FMT)
+
+template <typename E>
+struct fmt::formatter<E, char, std::enable_if_t<std::conjunction_v<std::is_enum<E>, magic_enum::enable_enum_format<E>>>>
+    : magic_enum::detail::enum_formatter<E, fmt::formatter> {};
+
+#endif
+
+#endif // NEARGYE_MAGIC_ENUM_FORMAT_HPP
@@ -0,0 +1,197 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_FSM_HPP
+#define NEARGYE_MAGIC_ENUM_FSM_HPP
+
+#include "magic_enum.hpp"
+#include "magic_enum_containers.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace magic_enum {
+
+// Transition from state to state on event.
+template <typename S, typename Ev>
+struct enum_transition {
+  S from;
+  Ev event;
+  S to;
+};
+
+// Transition matrix with one entry for each combination of state value and event value, O(1) lookup.
+// Use static_assert(table.complete()) to check that transition is defined for each combination at compile time.
+template <typename S, typename Ev>
+class enum_transition_table {
+  static_assert(std::is_enum_v<S>, "magic_enum::enum_transition_table requires enum type.");
+  static_assert(std::is_enum_v<Ev>, "magic_enum::enum_transition_table requires enum type.");
+
+ public:
+  using state_type = S;
+  using event_type = Ev;
+
+  // Constructs table without transitions.
+  constexpr enum_transition_table() noexcept {
+    for (auto& t : targets_) {
+      t = detail::invalid_index_v<S>;
+    }
+  }
+
+  // Constructs table from transitions, the last transition wins if transition is repeated.
+  // The behavior is undefined if state value or event value does not have name.
+  template <std::size_t N>
+  constexpr enum_transition_table(const enum_transition<S, Ev> (&transitions)[N]) noexcept : enum_transition_table{} {
+    for (const auto& t : transitions) {
+      add(t.from, t.event, t.to);
+    }
+  }
+
+  // Adds transition, replaces existing transition from state on event.
+  // The behavior is undefined if state value or event value does not have name.
+  constexpr enum_transition_table& add(S from, Ev event, S to) noexcept {
+    assert(detail::index_impl<S>(to) < detail::count_v<S>);
+    targets_[key(detail::index_impl<S>(from), detail::index_impl<Ev>(event))] = static_cast<detail::index_t<S>>(detail::index_impl<S>(to));
+
+    return *this;
+  }
+
+  // Returns target state of transition from state on event, or std::nullopt if transition is not defined.
+  [[nodiscard]] constexpr std::optional<S> target(S from, Ev event) const noexcept {
+    const auto s = detail::index_impl<S>(from);
+    const auto e = detail::index_impl<Ev>(event);
+    if (s < detail::count_v<S> && e < detail::count_v<Ev>) {
+      if (auto t = targets_[key(s, e)]; t != detail::invalid_index_v<S>) {
+        return detail::values_v<S>[t];
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  // Returns first combination of state value and event value (sorted by enum value) without transition, or std::nullopt.
+  [[nodiscard]] constexpr std::optional<std::pair<S, Ev>> missing() const noexcept {
+    for (std::size_t i = 0; i < targets_.size(); ++i) {
+      if (targets_[i] == detail::invalid_index_v<S>) {
+        return std::pair<S, Ev>{detail::values_v<S>[i / detail::count_v<Ev>], detail::values_v<Ev>[i % detail::count_v<Ev>]};
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  // Checks whether transition is defined for each combination of state value and event value.
+  [[nodiscard]] constexpr bool complete() const noexcept { return !missing().has_value(); }
+
+ private:
+  template <typename, typename>
+  friend class enum_fsm;
+
+  [[nodiscard]] static constexpr std::size_t key(std::size_t state_index, std::size_t event_index) noexcept {
+    return assert(state_index < detail::count_v<S> && event_index < detail::count_v<Ev>), state_index * detail::count_v<Ev> + event_index;
+  }
+
+  std::array<detail::index_t<S>, detail::count_v<S> * detail::count_v<Ev>> targets_{};
+};
+
+// Finite state machine over transition table, with optional callbacks on entering states and trace of transitions by names.
+template <typename S, typename Ev>
+class enum_fsm {
+ public:
+  using state_type = S;
+  using event_type = Ev;
+  using table_type = enum_transition_table<S, Ev>;
+  using callback_type = std::function<void(S from, Ev event, S to)>;
+  using trace_type = std::function<void(std::string_view from, std::string_view event, std::string_view to)>;
+
+  // Copies table, it is small array of state indexes, so temporary table can be passed.
+  // The behavior is undefined if initial state value does not have name.
+  enum_fsm(const table_type& table, S initial) noexcept
+      : table_{table}, state_{detail::index_impl<S>(initial)} {
+    assert(state_ < detail::count_v<S>);
+  }
+
+  [[nodiscard]] constexpr S state() const noexcept { return detail::values_v<S>[state_]; }
+
+  // Returns name of current state from name table, without lookup of value.
+  [[nodiscard]] constexpr std::string_view state_name() const noexcept { return detail::names_v<S>[state_]; }
+
+  // Performs transition from current state on event, calls callback of the target state.
+  // Returns false and keeps current state if transition is not defined or event value does not have name.
+  bool fire(Ev event) {
+    const auto e = detail::index_impl<Ev>(event);
+    if (e >= detail::count_v<Ev>) {
+      return false;
+    }
+
+    const auto t = table_.targets_[table_type::key(state_, e)];
+    if (t == detail::invalid_index_v<S>) {
+      return false;
+    }
+
+    const auto from = state_;
+    state_ = t;
+    if (trace_) {
+      trace_(detail::names_v<S>[from], detail::names_v<Ev>[e], detail::names_v<S>[t]);
+    }
+    if (on_enter_.a[t]) {
+      on_enter_.a[t](detail::values_v<S>[from], event, state());
+    }
+
+    return true;
+  }
+
+  // Sets callback, called with (from, event, to) after each transition into state, including transitions to the same state.
+  void on_enter(S state, callback_type callback) {
+    on_enter_[state] = std::move(callback);
+  }
+
+  // Sets trace, called with names of (from, event, to) from name tables after each transition, before callback of state.
+  void on_trace(trace_type trace) {
+    trace_ = std::move(trace);
+  }
+
+ private:
+  table_type table_;
+  std::size_t state_;
+  enum_array<S, callback_type> on_enter_{};
+  trace_type trace_;
+};
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_FSM_HPP
@@ -0,0 +1,130 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_FUSE_HPP
+#define NEARGYE_MAGIC_ENUM_FUSE_HPP
+
+#include "magic_enum.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace magic_enum {
+
+namespace detail {
+
+// Number of combinations of enum values.
+template <typename... Es>
+inline constexpr std::size_t fuse_count_v = (count_v<Es> * ... * 1);
+
+// Digit of enum J in mixed radix fused key K, the last enum is the least significant digit.
+template <std::size_t K, std::size_t J, typename... Es>
+[[nodiscard]] constexpr std::size_t fuse_digit() noexcept {
+  constexpr std::array<std::size_t, sizeof...(Es)> counts{{count_v<Es>...}};
+  std::size_t stride = 1;
+  for (std::size_t i = J + 1; i < counts.size(); ++i) {
+    stride *= counts[i];
+  }
+
+  return (K / stride) % counts[J];
+}
+
+template <typename Visitor, typename... Es>
+using fuse_result_t = std::invoke_result_t<Visitor, std::integral_constant<Es, values_v<Es>[0]>...>;
+
+template <typename R, std::size_t K, typename Visitor, typename... Es, std::size_t... J>
+constexpr R fuse_case_impl(Visitor&& visitor, std::index_sequence<J...>) {
+  return static_cast<R>(std::forward<Visitor>(visitor)(std::integral_constant<Es, values_v<Es>[fuse_digit<K, J, Es...>()]>{}...));
+}
+
+template <typename R, std::size_t K, typename Visitor, typename... Es>
+constexpr R fuse_case(Visitor&& visitor) {
+  return fuse_case_impl<R, K, Visitor, Es...>(std::forward<Visitor>(visitor), std::index_sequence_for<Es...>{});
+}
+
+template <typename R, typename Visitor, typename... Es, std::size_t... K>
+constexpr auto fuse_table_impl(std::index_sequence<K...>) noexcept {
+  return std::array<R (*)(Visitor&&), sizeof...(K)>{{&fuse_case<R, K, Visitor, Es...>...}};
+}
+
+template <typename R, typename Visitor, typename... Es>
+inline constexpr auto fuse_table_v = fuse_table_impl<R, Visitor, Es...>(std::make_index_sequence<fuse_count_v<Es...>>{});
+
+} // namespace magic_enum::detail
+
+// Obtains dense key of combination of enum values, in range [0, product of number of enum values).
+// Keys are ordered like tuples of indexes in enum value sequences, the last enum value is the least significant.
+// Returns std::optional with key, or std::nullopt if any value does not have name.
+template <typename... Es>
+[[nodiscard]] constexpr std::optional<std::size_t> enum_fuse(Es... values) noexcept {
+  static_assert(sizeof...(Es) > 0, "magic_enum::enum_fuse requires at least one enum value.");
+  static_assert((std::is_enum_v<Es> && ...), "magic_enum::enum_fuse requires enum type.");
+  constexpr std::array<std::size_t, sizeof...(Es)> counts{{detail::count_v<Es>...}};
+  const std::array<std::size_t, sizeof...(Es)> indexes{{detail::index_impl<Es>(values)...}};
+
+  std::size_t key = 0;
+  for (std::size_t i = 0; i < indexes.size(); ++i) {
+    if (indexes[i] >= counts[i]) {
+      return std::nullopt; // Invalid value or out of range.
+    }
+    key = key * counts[i] + indexes[i];
+  }
+
+  return key;
+}
+
+// Calls visitor(std::integral_constant<E1, value1>{}, std::integral_constant<E2, value2>{}, ...) for runtime enum values,
+// through one table of function pointers indexed by enum_fuse(values...), table has one entry for each combination of enum values.
+// Returns result of the call, converted to the result type of visitor for the first enum values,
+// or value-initialized result if any value does not have name.
+template <typename Visitor, typename... Es>
+constexpr decltype(auto) enum_fuse_switch(Visitor&& visitor, Es... values) {
+  static_assert(sizeof...(Es) > 0, "magic_enum::enum_fuse_switch requires at least one enum value.");
+  static_assert((std::is_enum_v<Es> && ...), "magic_enum::enum_fuse_switch requires enum type.");
+  static_assert(((detail::count_v<Es> > 0) && ...), "magic_enum::enum_fuse_switch requires enum with values.");
+  using R = detail::fuse_result_t<Visitor, Es...>;
+  constexpr auto& table = detail::fuse_table_v<R, Visitor, Es...>;
+
+  if (auto key = enum_fuse(values...); key.has_value()) {
+    return table[*key](std::forward<Visitor>(visitor));
+  }
+
+  if constexpr (!std::is_void_v<R>) {
+    return R{};
+  }
+}
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_FUSE_HPP
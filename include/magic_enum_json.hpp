@@ -0,0 +1,180 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_JSON_HPP
+#define NEARGYE_MAGIC_ENUM_JSON_HPP
+
+#include "magic_enum.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace magic_enum {
+
+namespace detail {
+
+template <typename E>
+[[nodiscard]] constexpr std::size_t json_chars_size() noexcept {
+  std::size_t size = 0;
+  for (auto name : names_v<E>) {
+    size += name.size() + 2;
+  }
+
+  return size;
+}
+
+// String enum names enclosed in quotes, stored one after another.
+// Enum names consist of [A-Za-z0-9_] characters, so they never need escaping in JSON.
+template <typename E>
+struct json_table {
+  std::array<char, json_chars_size<E>()> chars{};
+  std::array<std::size_t, count_v<E> + 1> offsets{};
+  std::size_t max_size = 0;
+
+  [[nodiscard]] constexpr std::string_view operator[](std::size_t i) const noexcept {
+    return {chars.data() + offsets[i], offsets[i + 1] - offsets[i]};
+  }
+};
+
+template <typename E>
+[[nodiscard]] constexpr auto json_table_impl() noexcept {
+  json_table<E> table{};
+
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < count_v<E>; ++i) {
+    table.offsets[i] = k;
+    table.chars[k++] = '"';
+    for (auto c : names_v<E>[i]) {
+      table.chars[k++] = c;
+    }
+    table.chars[k++] = '"';
+    table.max_size = names_v<E>[i].size() + 2 > table.max_size ? names_v<E>[i].size() + 2 : table.max_size;
+  }
+  table.offsets[count_v<E>] = k;
+
+  return table;
+}
+
+template <typename E>
+inline constexpr auto json_table_v = json_table_impl<E>();
+
+} // namespace magic_enum::detail
+
+// Returns maximum number of characters written by write_json for enum type E.
+template <typename E>
+[[nodiscard]] constexpr std::size_t json_max_size() noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::json_max_size requires enum type.");
+  // Sign and decimal digits of underlying integer, written for enum value without name.
+  constexpr std::size_t integer_size = std::numeric_limits<std::underlying_type_t<E>>::digits10 + 2;
+
+  return detail::json_table_v<E>.max_size > integer_size ? detail::json_table_v<E>.max_size : integer_size;
+}
+
+// Returns string enum name enclosed in quotes, or empty string if value does not have name.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr std::string_view json_name(E value) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::json_name requires enum type.");
+
+  if (auto i = detail::index_impl<D>(value); i < detail::count_v<D>) {
+    return detail::json_table_v<D>[i];
+  }
+
+  return {}; // Invalid value or out of range.
+}
+
+// Writes enum value as JSON string with string enum name, or as JSON number if value does not have name.
+// out must have space for json_max_size<E>() characters. Returns pointer one past the last written character.
+// Name is obtained by enum_name, so extern tables and statistics of enum type are used.
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+char* write_json(E value, char* out) noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::write_json requires enum type.");
+
+  if (auto name = enum_name(value); !name.empty()) {
+    *out++ = '"';
+    for (auto c : name) {
+      *out++ = c;
+    }
+    *out++ = '"';
+    return out;
+  }
+
+  return std::to_chars(out, out + json_max_size<D>(), static_cast<std::underlying_type_t<D>>(value)).ptr;
+}
+
+// Reads JSON string with string enum name, without escape sequences, or JSON integer number at cursor, so output of
+// write_json is read back. Number is read as enum value with such underlying integer, it may not have name.
+// Returns std::optional with enum value and moves cursor past the string or number,
+// or std::nullopt and does not move cursor if there is no such JSON string or integer number.
+template <typename E>
+[[nodiscard]] std::optional<E> read_json(const char*& cursor, const char* last) noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::read_json requires enum type.");
+  using U = std::underlying_type_t<E>;
+
+  if (cursor == last) {
+    return std::nullopt;
+  }
+
+  if (*cursor != '"') {
+    U integer = 0;
+    auto [ptr, ec] = std::from_chars(cursor, last, integer);
+    // Fraction or exponent means number is not integer.
+    if (ec != std::errc{} || (ptr != last && (*ptr == '.' || *ptr == 'e' || *ptr == 'E'))) {
+      return std::nullopt;
+    }
+    cursor = ptr;
+    return static_cast<E>(integer);
+  }
+
+  // Closing quote, within the longest quoted name.
+  auto end = cursor + 1;
+  while (end != last && *end != '"' && static_cast<std::size_t>(end - cursor) <= detail::max_name_length_v<E>) {
+    ++end;
+  }
+  if (end == last || *end != '"') {
+    return std::nullopt;
+  }
+
+  if (auto value = enum_cast<E>(std::string_view{cursor + 1, static_cast<std::size_t>(end - cursor - 1)})) {
+    cursor = end + 1;
+    return value;
+  }
+
+  return std::nullopt; // Invalid value or out of range.
+}
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_JSON_HPP
@@ -0,0 +1,200 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_MAGIC_ENUM_REGISTRY_HPP
+#define NEARGYE_MAGIC_ENUM_REGISTRY_HPP
+
+#include "magic_enum.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+// Maximum number of enum types in registry, must be power of two. By default MAGIC_ENUM_REGISTRY_CAPACITY = 256.
+// Registry is open addressing hash table, keep it at most half full for short probes.
+#if !defined(MAGIC_ENUM_REGISTRY_CAPACITY)
+#  define MAGIC_ENUM_REGISTRY_CAPACITY 256
+#endif
+
+#define MAGIC_ENUM_REGISTRY_CONCAT_IMPL(a, b) a##b
+#define MAGIC_ENUM_REGISTRY_CONCAT(a, b) MAGIC_ENUM_REGISTRY_CONCAT_IMPL(a, b)
+
+// Publishes descriptor of enum type E in registry under enum_type_name<E>(), during dynamic initialization.
+// Must be used at namespace scope, may be repeated in several translation units.
+#define MAGIC_ENUM_REGISTER(E)                                                                            \
+  [[maybe_unused]] static const bool MAGIC_ENUM_REGISTRY_CONCAT(magic_enum_registered_, __COUNTER__) = \
+      ::magic_enum::registry::add(::magic_enum::registry::descriptor<E>())
+
+namespace magic_enum {
+
+static_assert(MAGIC_ENUM_REGISTRY_CAPACITY > 0 && (MAGIC_ENUM_REGISTRY_CAPACITY & (MAGIC_ENUM_REGISTRY_CAPACITY - 1)) == 0,
+              "MAGIC_ENUM_REGISTRY_CAPACITY must be power of two.");
+
+// Pair (integer value, string enum name), integer value is enum value converted to std::int64_t.
+struct enum_entry {
+  std::int64_t value;
+  std::string_view name;
+};
+
+// Type-erased reflection of enum type.
+struct enum_descriptor {
+  std::string_view type_name;
+  std::uint64_t type_hash;
+  const enum_entry* entries; // Sorted by enum value, same order as enum_entries.
+  std::size_t count;
+  std::optional<std::int64_t> (*cast)(std::string_view name) noexcept;
+  std::string_view (*name)(std::int64_t value) noexcept;
+};
+
+namespace detail {
+
+template <typename E, std::size_t... I>
+[[nodiscard]] constexpr auto erased_entries_impl(std::index_sequence<I...>) noexcept {
+  return std::array<enum_entry, sizeof...(I)>{{{static_cast<std::int64_t>(values_v<E>[I]), names_v<E>[I]}...}};
+}
+
+template <typename E>
+inline constexpr auto erased_entries_v = erased_entries_impl<E>(std::make_index_sequence<count_v<E>>{});
+
+template <typename E>
+std::optional<std::int64_t> erased_cast(std::string_view name) noexcept {
+  if (auto v = enum_cast<E>(name); v.has_value()) {
+    return static_cast<std::int64_t>(v.value());
+  }
+
+  return std::nullopt;
+}
+
+template <typename E>
+std::string_view erased_name(std::int64_t value) noexcept {
+  using U = std::underlying_type_t<E>;
+  if (static_cast<std::int64_t>(static_cast<U>(value)) != value) {
+    return {}; // Value does not fit in underlying type.
+  }
+
+  return enum_name(static_cast<E>(static_cast<U>(value)));
+}
+
+template <typename E>
+inline constexpr enum_descriptor descriptor_v{enum_type_name<E>(), enum_type_hash<E>(), erased_entries_v<E>.data(), count_v<E>, &erased_cast<E>, &erased_name<E>};
+
+inline std::array<std::atomic<const enum_descriptor*>, MAGIC_ENUM_REGISTRY_CAPACITY> registry_slots{};
+
+} // namespace magic_enum::detail
+
+// Registry of type-erased enum descriptors, for lookup by type name at runtime, e.g. in RPC or admin interfaces.
+// Descriptors are published once and never removed, readers take no locks and see each descriptor fully initialized.
+namespace registry {
+
+// Returns descriptor of enum type E, in static storage, type name is enum_type_name<E>().
+template <typename E, typename D = detail::enable_if_enum_t<E>>
+[[nodiscard]] constexpr const enum_descriptor& descriptor() noexcept {
+  static_assert(detail::check_enum_v<E, D>, "magic_enum::registry::descriptor requires enum type.");
+
+  return detail::descriptor_v<D>;
+}
+
+// Publishes descriptor, lock-free. Returns false if registry is full or other descriptor with the same type name is registered.
+inline bool add(const enum_descriptor& d) noexcept {
+  constexpr std::size_t mask = MAGIC_ENUM_REGISTRY_CAPACITY - 1;
+
+  for (std::size_t i = 0, h = static_cast<std::size_t>(d.type_hash) & mask; i < MAGIC_ENUM_REGISTRY_CAPACITY; ++i, h = (h + 1) & mask) {
+    const enum_descriptor* expected = nullptr;
+    if (detail::registry_slots[h].compare_exchange_strong(expected, &d, std::memory_order_release, std::memory_order_acquire)) {
+      return true;
+    }
+    if (expected == &d) {
+      return true; // Already registered.
+    }
+    if (expected->type_hash == d.type_hash && expected->type_name == d.type_name) {
+      return false; // Other enum type with the same name.
+    }
+  }
+
+  return false; // Registry is full.
+}
+
+// Returns descriptor registered under type name, or nullptr.
+[[nodiscard]] inline const enum_descriptor* find(std::string_view type_name) noexcept {
+  constexpr std::size_t mask = MAGIC_ENUM_REGISTRY_CAPACITY - 1;
+  const auto hash = detail::hash_fnv1a(type_name);
+
+  for (std::size_t i = 0, h = static_cast<std::size_t>(hash) & mask; i < MAGIC_ENUM_REGISTRY_CAPACITY; ++i, h = (h + 1) & mask) {
+    const auto* d = detail::registry_slots[h].load(std::memory_order_acquire);
+    if (d == nullptr) {
+      break;
+    }
+    if (d->type_hash == hash && d->type_name == type_name) {
+      return d;
+    }
+  }
+
+  return nullptr;
+}
+
+// Obtains integer value from type name and string enum name.
+// Returns std::optional with integer value, std::nullopt if type is not registered or name is invalid.
+[[nodiscard]] inline std::optional<std::int64_t> cast(std::string_view type_name, std::string_view name) noexcept {
+  if (const auto* d = find(type_name); d != nullptr) {
+    return d->cast(name);
+  }
+
+  return std::nullopt;
+}
+
+// Returns string enum name from type name and integer value, empty if type is not registered or value does not have name.
+[[nodiscard]] inline std::string_view name(std::string_view type_name, std::int64_t value) noexcept {
+  if (const auto* d = find(type_name); d != nullptr) {
+    return d->name(value);
+  }
+
+  return {};
+}
+
+// Calls visitor with each registered descriptor, in unspecified order.
+template <typename Visitor>
+void visit(Visitor&& visitor) {
+  for (auto& slot : detail::registry_slots) {
+    if (const auto* d = slot.load(std::memory_order_acquire); d != nullptr) {
+      visitor(*d);
+    }
+  }
+}
+
+} // namespace magic_enum::registry
+
+} // namespace magic_enum
+
+#endif // NEARGYE_MAGIC_ENUM_REGISTRY_HPP
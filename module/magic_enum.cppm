@@ -0,0 +1,156 @@
+//  __  __             _        ______                          _____
+// |  \/  |           (_)      |  ____|                        / ____|_     _
+// | \  / | __ _  __ _ _  ___  | |__   _ __  _   _ _ __ ___   | |   _| |_ _| |_
+// | |\/| |/ _` |/ _` | |/ __| |  __| | '_ \| | | | '_ ` _ \  | |  |_   _|_   _|
+// | |  | | (_| | (_| | | (__  | |____| | | | |_| | | | | | | | |____|_|   |_|
+// |_|  |_|\__,_|\__, |_|\___| |______|_| |_|\__,_|_| |_| |_|  \_____|
+//                __/ | https://github.com/Neargye/magic_enum
+//               |___/  vesion 0.6.0
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++20 module interface for magic_enum, see MAGIC_ENUM_OPT_BUILD_MODULE.
+// Macros (MAGIC_ENUM_RANGE_MIN, MAGIC_ENUM_RANGE_MAX, MAGIC_ENUM_DECLARE_TABLES, ...) are not exported by modules,
+// configure them when building this interface and include magic_enum.hpp where the macros are needed.
+
+module;
+
+#include <magic_enum.hpp>
+#include <magic_enum_containers.hpp>
+#include <magic_enum_atomic.hpp>
+#include <magic_enum_switch.hpp>
+#include <magic_enum_fuse.hpp>
+#include <magic_enum_fsm.hpp>
+#include <magic_enum_format.hpp>
+#include <magic_enum_json.hpp>
+#include <magic_enum_binary.hpp>
+#include <magic_enum_dictionary.hpp>
+#include <magic_enum_batch.hpp>
+#include <magic_enum_registry.hpp>
+
+export module magic_enum;
+
+export namespace magic_enum {
+
+using magic_enum::enum_range;
+using magic_enum::enable_enum_format;
+using magic_enum::enum_format_max_size;
+
+using magic_enum::is_unscoped_enum;
+using magic_enum::is_unscoped_enum_v;
+using magic_enum::is_scoped_enum;
+using magic_enum::is_scoped_enum_v;
+using magic_enum::is_fixed_enum;
+using magic_enum::is_fixed_enum_v;
+using magic_enum::underlying_type;
+using magic_enum::underlying_type_t;
+
+using magic_enum::enum_cast;
+using magic_enum::enum_integer;
+using magic_enum::enum_value;
+using magic_enum::enum_index;
+using magic_enum::enum_values;
+using magic_enum::enum_count;
+using magic_enum::enum_type_name;
+using magic_enum::enum_type_hash;
+using magic_enum::enum_name;
+using magic_enum::enum_names;
+using magic_enum::enum_entries;
+using magic_enum::enum_table_bytes;
+using magic_enum::table_bytes;
+using magic_enum::to_chars;
+using magic_enum::from_chars;
+
+using magic_enum::json_max_size;
+using magic_enum::json_name;
+using magic_enum::write_json;
+using magic_enum::read_json;
+
+using magic_enum::enum_code_t;
+using magic_enum::enum_fingerprint;
+using magic_enum::enum_encode;
+using magic_enum::enum_decode;
+
+using magic_enum::enum_dictionary_encode;
+using magic_enum::enum_dictionary_decoded_size;
+using magic_enum::enum_dictionary_decode;
+
+using magic_enum::thread_executor;
+using magic_enum::enum_cast_batch;
+using magic_enum::enum_name_batch;
+using magic_enum::enum_validate_batch;
+
+using magic_enum::enum_entry;
+using magic_enum::enum_descriptor;
+using magic_enum::enum_switch;
+using magic_enum::enum_fuse;
+using magic_enum::enum_fuse_switch;
+
+using magic_enum::enum_array;
+using magic_enum::enum_bitset;
+using magic_enum::packed_enum_vector;
+using magic_enum::atomic_enum_bitset;
+using magic_enum::enum_counter;
+
+using magic_enum::enum_transition;
+using magic_enum::enum_transition_table;
+using magic_enum::enum_fsm;
+
+namespace ostream_operators {
+using magic_enum::ostream_operators::operator<<;
+} // namespace magic_enum::ostream_operators
+
+namespace istream_operators {
+using magic_enum::istream_operators::operator>>;
+} // namespace magic_enum::istream_operators
+
+namespace bitwise_operators {
+using magic_enum::bitwise_operators::operator~;
+using magic_enum::bitwise_operators::operator|;
+using magic_enum::bitwise_operators::operator&;
+using magic_enum::bitwise_operators::operator^;
+using magic_enum::bitwise_operators::operator|=;
+using magic_enum::bitwise_operators::operator&=;
+using magic_enum::bitwise_operators::operator^=;
+} // namespace magic_enum::bitwise_operators
+
+namespace registry {
+using magic_enum::registry::descriptor;
+using magic_enum::registry::add;
+using magic_enum::registry::find;
+using magic_enum::registry::cast;
+using magic_enum::registry::name;
+using magic_enum::registry::visit;
+} // namespace magic_enum::registry
+
+#if defined(MAGIC_ENUM_STATS)
+namespace stats {
+using magic_enum::stats::entry;
+using magic_enum::stats::visit;
+using magic_enum::stats::get;
+using magic_enum::stats::dump;
+using magic_enum::stats::reset;
+} // namespace magic_enum::stats
+#endif
+
+} // namespace magic_enum
@@ -26,10 +26,35 @@
 #define MAGIC_ENUM_RANGE_MIN -120
 #define MAGIC_ENUM_RANGE_MAX 120
 #include <magic_enum.hpp>
+#include <magic_enum_containers.hpp>
+#include <magic_enum_atomic.hpp>
+#include <magic_enum_switch.hpp>
+#include <magic_enum_fuse.hpp>
+#include <magic_enum_fsm.hpp>
+#include <magic_enum_json.hpp>
+#include <magic_enum_binary.hpp>
+#include <magic_enum_dictionary.hpp>
+#include <magic_enum_batch.hpp>
+#include <magic_enum_registry.hpp>
+#if __has_include(<fmt/format.h>)
+#  define FMT_HEADER_ONLY
+#  define MAGIC_ENUM_ENABLE_FMT
+#endif
+#include <magic_enum_format.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
 #include <string_view>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 enum class Color { RED = -12, GREEN = 7, BLUE = 15 };
 
@@ -47,6 +72,24 @@ struct enum_range<number> {
 };
 }
 
+enum class Big : std::uint8_t { b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15, b16, b17, b18, b19, b20, b21, b22, b23, b24, b25, b26, b27, b28, b29, b30, b31, b32, b33, b34, b35, b36, b37, b38, b39, b40, b41, b42, b43, b44, b45, b46, b47, b48, b49, b50, b51, b52, b53, b54, b55, b56, b57, b58, b59, b60, b61, b62, b63, b64, b65, b66, b67, b68, b69 };
+
+enum class Wide : int { low = -200, zero = 0, high = 200 };
+
+namespace magic_enum {
+template <>
+struct enum_range<Wide> {
+  static constexpr int min = -200;
+  static constexpr int max = 200;
+};
+}
+
+#include "extern_tables.hpp"
+
+MAGIC_ENUM_REGISTER(Color);
+MAGIC_ENUM_REGISTER(Color);
+MAGIC_ENUM_REGISTER(number);
+
 using namespace magic_enum;
 
 TEST_CASE("enum_cast") {
@@ -167,6 +210,32 @@ TEST_CASE("enum_value") {
   REQUIRE(nt == number::three);
 }
 
+TEST_CASE("enum_index") {
+  constexpr auto cr = enum_index(Color::RED);
+  REQUIRE(cr.value() == 0);
+  REQUIRE(enum_index(Color::GREEN).value() == 1);
+  REQUIRE(enum_index(Color::BLUE).value() == 2);
+  REQUIRE_FALSE(enum_index(static_cast<Color>(0)).has_value());
+
+  constexpr auto no = enum_index(Numbers::one);
+  REQUIRE(no.value() == 0);
+  REQUIRE(enum_index(Numbers::two).value() == 1);
+  REQUIRE(enum_index(Numbers::three).value() == 2);
+  REQUIRE_FALSE(enum_index(Numbers::many).has_value());
+
+  constexpr auto dr = enum_index(Directions::Right);
+  REQUIRE(enum_index(Directions::Left).value() == 0);
+  REQUIRE(enum_index(Directions::Down).value() == 1);
+  REQUIRE(enum_index(Directions::Up).value() == 2);
+  REQUIRE(dr.value() == 3);
+
+  constexpr auto nt = enum_index(number::three);
+  REQUIRE(enum_index(number::one).value() == 0);
+  REQUIRE(enum_index(number::two).value() == 1);
+  REQUIRE(nt.value() == 2);
+  REQUIRE_FALSE(enum_index(number::four).has_value());
+}
+
 TEST_CASE("enum_values") {
   constexpr auto s1 = enum_values<Color>();
   REQUIRE(s1 == std::array<Color, 3>{{Color::RED, Color::GREEN, Color::BLUE}});
@@ -279,6 +348,28 @@ TEST_CASE("enum_names") {
   REQUIRE(s4 == std::array<std::string_view, 3>{{"one", "two", "three"}});
 }
 
+namespace outer {
+enum class Inner { a };
+struct Holder {
+  enum Nested { b };
+};
+} // namespace outer
+
+TEST_CASE("enum_type_name") {
+  constexpr auto n1 = enum_type_name<Color>();
+  REQUIRE(n1 == "Color");
+  REQUIRE(n1.data()[n1.size()] == '\0');
+  REQUIRE(enum_type_name<Color&>() == "Color");
+  REQUIRE(enum_type_name<number>() == "number");
+  REQUIRE(enum_type_name<outer::Inner>() == "outer::Inner");
+  REQUIRE(enum_type_name<outer::Holder::Nested>() == "outer::Holder::Nested");
+  REQUIRE(std::string_view{enum_type_name<Directions>().data()} == "Directions");
+
+  constexpr auto h1 = enum_type_hash<Color>();
+  REQUIRE(h1 == 0x344ea8f4939cdc98ULL);
+  REQUIRE(enum_type_hash<number>() != h1);
+}
+
 TEST_CASE("enum_entries") {
   constexpr auto s1 = enum_entries<Color>();
   REQUIRE(s1 == std::array<std::pair<Color, std::string_view>, 3>{{{Color::RED, "RED"}, {Color::GREEN, "GREEN"}, {Color::BLUE, "BLUE"}}});
@@ -293,6 +384,388 @@ TEST_CASE("enum_entries") {
   REQUIRE(s4 == std::array<std::pair<number, std::string_view>, 3>{{{number::one, "one"}, {number::two, "two"}, {number::three, "three"}}});
 }
 
+TEST_CASE("table_bytes") {
+  constexpr auto b1 = table_bytes<Color>();
+  REQUIRE(b1.strings == 241 * sizeof(std::string_view));
+  REQUIRE(b1.values == 3 * sizeof(Color));
+  REQUIRE(b1.names == 3 * sizeof(std::string_view));
+  REQUIRE(b1.entries == 3 * sizeof(std::pair<Color, std::string_view>));
+  REQUIRE(b1.indexes == 241);
+  REQUIRE(b1.characters == 12);
+  REQUIRE(b1.total == b1.strings + b1.values + b1.names + b1.entries + b1.indexes + b1.characters);
+
+  constexpr auto b2 = table_bytes<number>();
+  REQUIRE(b2.strings == 201 * sizeof(std::string_view));
+  REQUIRE(b2.values == 3 * sizeof(number));
+  REQUIRE(b2.characters == 11);
+}
+
+TEST_CASE("to_chars") {
+  std::array<char, 8> buffer{};
+  auto [p1, e1] = magic_enum::to_chars(buffer.data(), buffer.data() + buffer.size(), Color::GREEN);
+  REQUIRE(e1 == std::errc{});
+  REQUIRE(std::string_view(buffer.data(), static_cast<std::size_t>(p1 - buffer.data())) == "GREEN");
+
+  auto [p2, e2] = magic_enum::to_chars(buffer.data(), buffer.data() + 2, Directions::Right);
+  REQUIRE(e2 == std::errc::value_too_large);
+  REQUIRE(p2 == buffer.data() + 2);
+
+  auto [p3, e3] = magic_enum::to_chars(buffer.data(), buffer.data() + buffer.size(), Numbers::many);
+  REQUIRE(e3 == std::errc::invalid_argument);
+  REQUIRE(p3 == buffer.data());
+
+  auto [p4, e4] = magic_enum::to_chars(buffer.data(), buffer.data() + 3, number::one);
+  REQUIRE(e4 == std::errc{});
+  REQUIRE(p4 == buffer.data() + 3);
+}
+
+TEST_CASE("from_chars") {
+  constexpr std::string_view input = "BLUE,RED GREENISH";
+  Color c = Color::GREEN;
+
+  auto [p1, e1] = magic_enum::from_chars(input.data(), input.data() + input.size(), c);
+  REQUIRE(e1 == std::errc{});
+  REQUIRE(c == Color::BLUE);
+  REQUIRE(p1 == input.data() + 4);
+
+  auto [p2, e2] = magic_enum::from_chars(p1 + 1, input.data() + input.size(), c);
+  REQUIRE(e2 == std::errc{});
+  REQUIRE(c == Color::RED);
+  REQUIRE(*p2 == ' ');
+
+  auto [p3, e3] = magic_enum::from_chars(p2 + 1, input.data() + input.size(), c);
+  REQUIRE(e3 == std::errc::invalid_argument);
+  REQUIRE(p3 == p2 + 1);
+  REQUIRE(c == Color::RED);
+
+  auto [p4, e4] = magic_enum::from_chars(p1, input.data() + input.size(), c);
+  REQUIRE(e4 == std::errc::invalid_argument);
+  REQUIRE(p4 == p1);
+
+  Directions d = Directions::Up;
+  constexpr std::string_view left = "Left";
+  REQUIRE(magic_enum::from_chars(left.data(), left.data() + left.size(), d).ec == std::errc{});
+  REQUIRE(d == Directions::Left);
+  REQUIRE(magic_enum::from_chars(left.data(), left.data() + 2, d).ec == std::errc::invalid_argument);
+  REQUIRE(magic_enum::from_chars(left.data(), left.data(), d).ec == std::errc::invalid_argument);
+}
+
+TEST_CASE("json") {
+  SECTION("json_name") {
+    constexpr auto cr = json_name(Color::RED);
+    static_assert(cr == "\"RED\"");
+    REQUIRE(json_name(Directions::Right) == "\"Right\"");
+    REQUIRE(json_name(Numbers::many).empty());
+    REQUIRE(json_max_size<Directions>() == std::numeric_limits<int>::digits10 + 2);
+    REQUIRE(json_max_size<Big>() == 5);
+  }
+
+  SECTION("write_json") {
+    std::array<char, 64> buffer{};
+    auto out = write_json(Color::GREEN, buffer.data());
+    *out++ = ',';
+    out = write_json(number::three, out);
+    *out++ = ',';
+    out = write_json(Numbers::many, out);
+    REQUIRE(std::string_view(buffer.data(), static_cast<std::size_t>(out - buffer.data())) == "\"GREEN\",\"three\",127");
+  }
+
+  SECTION("read_json") {
+    constexpr std::string_view input = R"("Up","Left" "Upper" "Down Left)";
+    const char* cursor = input.data();
+    const char* last = input.data() + input.size();
+
+    REQUIRE(read_json<Directions>(cursor, last).value() == Directions::Up);
+    REQUIRE(*cursor == ',');
+    ++cursor;
+    REQUIRE(read_json<Directions>(cursor, last).value() == Directions::Left);
+    REQUIRE_FALSE(read_json<Directions>(cursor, last).has_value());
+    ++cursor;
+    const auto upper = cursor;
+    REQUIRE_FALSE(read_json<Directions>(cursor, last).has_value());
+    REQUIRE(cursor == upper);
+    cursor += 8;
+    REQUIRE_FALSE(read_json<Directions>(cursor, last).has_value());
+    REQUIRE_FALSE(read_json<Directions>(last, last).has_value());
+  }
+
+  SECTION("round_trip") {
+    std::array<char, 64> buffer{};
+    auto out = write_json(Numbers::many, buffer.data());
+    *out++ = ',';
+    out = write_json(Numbers::two, out);
+    *out++ = ',';
+    out = write_json(static_cast<Color>(-100), out);
+    const char* cursor = buffer.data();
+    REQUIRE(read_json<Numbers>(cursor, out).value() == Numbers::many);
+    REQUIRE(*cursor++ == ',');
+    REQUIRE(read_json<Numbers>(cursor, out).value() == Numbers::two);
+    REQUIRE(*cursor++ == ',');
+    REQUIRE(read_json<Color>(cursor, out).value() == static_cast<Color>(-100));
+    REQUIRE(cursor == out);
+
+    constexpr std::string_view invalid = "1.5 300 x";
+    cursor = invalid.data();
+    REQUIRE_FALSE(read_json<Color>(cursor, invalid.data() + invalid.size()).has_value());
+    REQUIRE(cursor == invalid.data());
+    cursor += 4;
+    REQUIRE_FALSE(read_json<Big>(cursor, invalid.data() + invalid.size()).has_value());
+    cursor += 4;
+    REQUIRE_FALSE(read_json<Color>(cursor, invalid.data() + invalid.size()).has_value());
+  }
+}
+
+namespace v1 {
+enum class Status { ok, failed };
+}
+
+namespace v2 {
+enum class Status { ok, failed, retry };
+}
+
+namespace v3 {
+enum class Status { ok = 0, failed = 2 };
+}
+
+namespace v4 {
+enum class Status { ok, error };
+}
+
+TEST_CASE("binary") {
+  SECTION("enum_fingerprint") {
+    constexpr auto f1 = enum_fingerprint<v1::Status>();
+    static_assert(f1 != 0);
+    REQUIRE(f1 != enum_fingerprint<v2::Status>());
+    REQUIRE(f1 != enum_fingerprint<v3::Status>());
+    REQUIRE(f1 != enum_fingerprint<v4::Status>());
+    REQUIRE(enum_fingerprint<Numbers>() != enum_fingerprint<number>());
+    REQUIRE(enum_fingerprint<Color>() == enum_fingerprint<Color>());
+  }
+
+  SECTION("enum_encode") {
+    static_assert(std::is_same_v<enum_code_t<Color>, std::uint8_t>);
+    constexpr auto cr = enum_encode(Color::BLUE);
+    static_assert(cr.value() == 2);
+    REQUIRE(enum_encode(Directions::Left).value() == 0);
+    REQUIRE_FALSE(enum_encode(Numbers::many).has_value());
+
+    REQUIRE(enum_decode<Color>(1).value() == Color::GREEN);
+    REQUIRE(enum_decode<number>(2).value() == number::three);
+    REQUIRE_FALSE(enum_decode<number>(3).has_value());
+    REQUIRE_FALSE(enum_decode<Big>(1000).has_value());
+  }
+
+  SECTION("bytes") {
+    std::array<unsigned char, 4> buffer{};
+    auto out = enum_encode(Big::b69, buffer.data());
+    out = enum_encode(Color::RED, out);
+    REQUIRE(out == buffer.data() + 2);
+    REQUIRE(enum_encode(Numbers::many, out) == nullptr);
+    REQUIRE(enum_encode(static_cast<Color>(0), out) == nullptr);
+    REQUIRE(buffer[2] == 0);
+    buffer[2] = 200;
+
+    const unsigned char* cursor = buffer.data();
+    const unsigned char* last = buffer.data() + 3;
+    REQUIRE(enum_decode<Big>(cursor, last).value() == Big::b69);
+    REQUIRE(enum_decode<Color>(cursor, last).value() == Color::RED);
+    REQUIRE_FALSE(enum_decode<Color>(cursor, last).has_value());
+    REQUIRE(cursor == buffer.data() + 2);
+    REQUIRE_FALSE(enum_decode<Color>(last, last).has_value());
+  }
+}
+
+#if defined(MAGIC_ENUM_STATS)
+enum class Counted { a, b, c };
+
+TEST_CASE("stats") {
+  constexpr auto b = enum_cast<Counted>("b"); // Not counted in constant evaluation.
+  REQUIRE(b == Counted::b);
+
+  REQUIRE(enum_cast<Counted>("a").has_value());
+  REQUIRE(enum_cast<Counted>("c").has_value());
+  REQUIRE_FALSE(enum_cast<Counted>("d").has_value());
+  REQUIRE(enum_cast<Counted>(1).has_value());
+  REQUIRE_FALSE(enum_cast<Counted>(7).has_value());
+  REQUIRE_FALSE(enum_cast<Counted>(-1).has_value());
+  REQUIRE(enum_name(Counted::a) == "a");
+  REQUIRE(enum_name(static_cast<Counted>(9)).empty());
+
+  auto e = magic_enum::stats::get<Counted>();
+  REQUIRE(std::string_view{e.type} == enum_type_name<Counted>());
+  REQUIRE(e.cast_string_hits == 2);
+  REQUIRE(e.cast_string_misses == 1);
+  REQUIRE(e.cast_integer_hits == 1);
+  REQUIRE(e.cast_integer_misses == 2);
+  REQUIRE(e.name_empty == 1);
+
+  std::size_t found = 0;
+  magic_enum::stats::visit([&](const magic_enum::stats::entry& entry) { found += entry.type == e.type; });
+  REQUIRE(found == 1);
+
+  std::ostringstream os;
+  magic_enum::stats::dump(os);
+  REQUIRE(os.str().find(std::string{e.type} + " cast_string_hits=2 cast_string_misses=1 cast_integer_hits=1 cast_integer_misses=2 name_empty=1\n") != std::string::npos);
+
+  magic_enum::stats::reset();
+  REQUIRE(magic_enum::stats::get<Counted>().cast_string_hits == 0);
+}
+#endif
+
+TEST_CASE("batch") {
+  constexpr std::size_t n = 100000;
+  std::vector<std::string_view> names(n);
+  std::vector<Color> expected(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    names[i] = i % 10 == 9 ? std::string_view{"black"} : enum_names<Color>()[i % 3];
+    expected[i] = i % 10 == 9 ? Color{} : enum_values<Color>()[i % 3];
+  }
+  const std::size_t invalid = n / 10;
+
+  std::vector<Color> values(n);
+  std::vector<std::string_view> out(n);
+  REQUIRE(enum_cast_batch<Color>(names.data(), n, values.data()) == invalid);
+  REQUIRE(values == expected);
+  REQUIRE(enum_name_batch(values.data(), n, out.data()) == invalid);
+  REQUIRE(enum_validate_batch(values.data(), n) == invalid);
+  for (std::size_t i = 0; i < n; ++i) {
+    REQUIRE(out[i] == (i % 10 == 9 ? std::string_view{} : names[i]));
+  }
+
+  const thread_executor executor{4};
+  REQUIRE(executor.threads() == 4);
+  std::fill(values.begin(), values.end(), Color::RED);
+  REQUIRE(enum_cast_batch<Color>(executor, names.data(), n, values.data()) == invalid);
+  REQUIRE(values == expected);
+  REQUIRE(enum_name_batch(executor, values.data(), n, out.data()) == invalid);
+  REQUIRE(enum_validate_batch(executor, values.data(), n) == invalid);
+  REQUIRE(enum_validate_batch(executor, values.data(), 0) == 0);
+
+  // Exception on calling thread propagates after started threads are joined.
+  std::atomic<bool> thrown{false};
+  const auto caller = std::this_thread::get_id();
+  REQUIRE_THROWS_AS(executor(1000, [&](std::size_t) {
+    if (std::this_thread::get_id() == caller) {
+      thrown = true;
+      throw std::runtime_error{"task"};
+    }
+    while (!thrown) {
+      std::this_thread::yield();
+    }
+  }), std::runtime_error);
+
+  std::vector<Big> bigs(n);
+  std::vector<std::string_view> big_names(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    big_names[i] = i % 10 == 9 ? std::string_view{"b70"} : enum_names<Big>()[i % enum_count<Big>()];
+  }
+  REQUIRE(enum_cast_batch<Big>(executor, big_names.data(), n, bigs.data()) == invalid);
+  for (std::size_t i = 0; i < n; ++i) {
+    REQUIRE(bigs[i] == (i % 10 == 9 ? Big{} : enum_values<Big>()[i % enum_count<Big>()]));
+  }
+
+  // Adapter to external thread pool: any callable which runs task(chunk) for each chunk.
+  std::size_t chunks = 0;
+  auto inline_pool = [&chunks](std::size_t count, auto&& task) {
+    chunks = count;
+    for (std::size_t i = 0; i < count; ++i) {
+      task(i);
+    }
+  };
+  REQUIRE(enum_validate_batch(inline_pool, values.data(), n) == invalid);
+  REQUIRE(chunks > 1);
+
+#if defined(__cpp_lib_execution)
+  std::fill(values.begin(), values.end(), Color::RED);
+  REQUIRE(enum_cast_batch<Color>(std::execution::seq, names.data(), n, values.data()) == invalid);
+  REQUIRE(values == expected);
+  REQUIRE(enum_name_batch(std::execution::seq, values.data(), n, out.data()) == invalid);
+  REQUIRE(enum_validate_batch(std::execution::seq, values.data(), n) == invalid);
+#  if defined(MAGIC_ENUM_TEST_PARALLEL_POLICY)
+  std::fill(values.begin(), values.end(), Color::RED);
+  REQUIRE(enum_cast_batch<Color>(std::execution::par, names.data(), n, values.data()) == invalid);
+  REQUIRE(values == expected);
+  REQUIRE(enum_name_batch(std::execution::par_unseq, values.data(), n, out.data()) == invalid);
+  REQUIRE(enum_validate_batch(std::execution::par, values.data(), n) == invalid);
+#  endif
+#endif
+}
+
+TEST_CASE("registry") {
+  const auto* color = registry::find("Color");
+  REQUIRE(color != nullptr);
+  REQUIRE(color == &registry::descriptor<Color>());
+  REQUIRE(color->type_name == "Color");
+  REQUIRE(color->count == 3);
+  REQUIRE(color->entries[0].value == -12);
+  REQUIRE(color->entries[0].name == "RED");
+  REQUIRE(color->entries[2].name == "BLUE");
+  REQUIRE(registry::find("Colour") == nullptr);
+
+  REQUIRE(registry::cast("Color", "GREEN") == 7);
+  REQUIRE_FALSE(registry::cast("Color", "green").has_value());
+  REQUIRE_FALSE(registry::cast("Colour", "GREEN").has_value());
+  REQUIRE(registry::name("Color", 15) == "BLUE");
+  REQUIRE(registry::name("Color", 16).empty());
+  REQUIRE(registry::name("number", 300) == "three");
+  REQUIRE(registry::name("number", -300).empty());
+  REQUIRE(registry::name("Numbers", 10).empty());
+
+  REQUIRE(registry::add(registry::descriptor<Numbers>()));
+  REQUIRE(registry::add(registry::descriptor<Numbers>()));
+  REQUIRE(registry::name("Numbers", 10) == "one");
+
+  const enum_descriptor other{"Color", color->type_hash, nullptr, 0, nullptr, nullptr};
+  REQUIRE_FALSE(registry::add(other));
+
+  std::size_t count = 0;
+  registry::visit([&](const enum_descriptor& d) { count += d.type_name == "Color" || d.type_name == "number" || d.type_name == "Numbers"; });
+  REQUIRE(count == 3);
+}
+
+TEST_CASE("dictionary") {
+  const std::vector<std::string_view> rows{"RED", "", "BLUE", "GREEN", "RED ", "BLUE", "green", "RED", "GREEN", "red"};
+  std::vector<std::int32_t> offsets{0};
+  std::string data;
+  for (auto row : rows) {
+    data.append(row);
+    offsets.push_back(static_cast<std::int32_t>(data.size()));
+  }
+
+  std::vector<Color> values(rows.size());
+  std::vector<std::uint8_t> invalid((rows.size() + 7) / 8, 0xFF);
+  REQUIRE(enum_dictionary_encode(offsets.data(), rows.size(), data.data(), values.data(), invalid.data()) == 4);
+  REQUIRE(invalid == std::vector<std::uint8_t>{0x52, 0x02});
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    if ((invalid[i / 8] >> (i % 8)) & 1) {
+      REQUIRE(values[i] == Color{});
+    } else {
+      REQUIRE(enum_name(values[i]) == rows[i]);
+    }
+  }
+
+  std::vector<Big> bigs;
+  std::string big_data;
+  std::vector<std::int64_t> big_offsets{0};
+  for (auto name : enum_names<Big>()) {
+    big_data.append(name);
+    big_offsets.push_back(static_cast<std::int64_t>(big_data.size()));
+  }
+  bigs.resize(enum_count<Big>());
+  std::vector<std::uint8_t> big_invalid((bigs.size() + 7) / 8);
+  REQUIRE(enum_dictionary_encode(big_offsets.data(), bigs.size(), big_data.data(), bigs.data(), big_invalid.data()) == 0);
+  constexpr auto big_values = enum_values<Big>();
+  REQUIRE(bigs == std::vector<Big>(big_values.begin(), big_values.end()));
+
+  const std::vector<Directions> directions{Directions::Up, static_cast<Directions>(0), Directions::Right, Directions::Left};
+  std::vector<std::int32_t> out_offsets(directions.size() + 1);
+  std::string out_data(enum_dictionary_decoded_size(directions.data(), directions.size()), '\0');
+  REQUIRE(out_data.size() == 11);
+  REQUIRE(enum_dictionary_decode(directions.data(), directions.size(), out_offsets.data(), out_data.data()) == 11);
+  REQUIRE(out_data == "UpRightLeft");
+  REQUIRE(out_offsets == std::vector<std::int32_t>{0, 2, 2, 7, 11});
+}
+
 TEST_CASE("ostream_operators") {
   auto test_ostream = [](auto e, std::string_view name) {
     using namespace magic_enum::ostream_operators;
@@ -327,6 +800,122 @@ TEST_CASE("ostream_operators") {
   test_ostream(number::four, "400");
   test_ostream(static_cast<number>(0), "0");
   test_ostream(std::make_optional(static_cast<number>(0)), "0");
+
+  SECTION("format") {
+    using namespace magic_enum::ostream_operators;
+    std::stringstream ss;
+    ss << std::setw(6) << Color::RED << '|' << std::left << std::setfill('.') << std::setw(6) << Color::BLUE << '|' << Color::GREEN;
+    REQUIRE(ss.str() == "   RED|BLUE..|GREEN");
+  }
+
+  SECTION("wide") {
+    using namespace magic_enum::ostream_operators;
+    std::wstringstream ss;
+    ss << Color::RED << Directions::Up << static_cast<Color>(0);
+    REQUIRE(ss.str() == L"REDUp0");
+  }
+
+  SECTION("wide_format") {
+    using namespace magic_enum::ostream_operators;
+    std::wostringstream ss;
+    ss << std::setw(6) << Color::RED << L'|' << std::left << std::setfill(L'.') << std::setw(6) << Color::BLUE << L'|' << Color::GREEN;
+    ss << L'|' << std::right << std::setw(4) << static_cast<Color>(0);
+    REQUIRE(ss.str() == L"   RED|BLUE..|GREEN|...0");
+  }
+}
+
+TEST_CASE("istream_operators") {
+  using namespace magic_enum::istream_operators;
+
+  SECTION("names") {
+    std::istringstream is{"RED  GREEN\tBLUE"};
+    Color c1 = Color::BLUE, c2 = Color::BLUE, c3 = Color::RED;
+    is >> c1 >> c2 >> c3;
+    REQUIRE(is);
+    REQUIRE(c1 == Color::RED);
+    REQUIRE(c2 == Color::GREEN);
+    REQUIRE(c3 == Color::BLUE);
+    REQUIRE(is.eof());
+  }
+
+  SECTION("delimiters") {
+    std::istringstream is{"Up,Left;"};
+    Directions d1 = Directions::Down, d2 = Directions::Down;
+    char sep = 0;
+    is >> d1 >> sep >> d2;
+    REQUIRE(is);
+    REQUIRE(d1 == Directions::Up);
+    REQUIRE(sep == ',');
+    REQUIRE(d2 == Directions::Left);
+    REQUIRE(is.peek() == ';');
+  }
+
+  SECTION("integers") {
+    std::istringstream is{"-12 +7 300"};
+    Color c1 = Color::BLUE, c2 = Color::BLUE;
+    number n = number::one;
+    is >> c1 >> c2 >> n;
+    REQUIRE(is);
+    REQUIRE(c1 == Color::RED);
+    REQUIRE(c2 == Color::GREEN);
+    REQUIRE(n == number::three);
+  }
+
+  SECTION("failures") {
+    auto fails = [](const char* input, auto value) {
+      std::istringstream is{input};
+      auto v = value;
+      is >> v;
+      REQUIRE(is.fail());
+      REQUIRE(v == value);
+    };
+    fails("REDDISH", Color::GREEN);
+    fails("many", Numbers::one);
+    fails("127", Numbers::one);
+    fails("0", Color::GREEN);
+    fails("-100", number::one);
+    fails("99999999999999999999999", Color::GREEN);
+    fails("4294967303", Color::GREEN);
+    fails("-2147483660", Color::GREEN);
+    fails("", Color::GREEN);
+    fails("?", Color::GREEN);
+    fails("-", Color::GREEN);
+  }
+
+  SECTION("zero_padded") {
+    std::istringstream is{"0000000000000000000000000007 -00000000000000000000000000012 +000000000000000000000000000"};
+    Color c1 = Color::RED, c2 = Color::GREEN;
+    Numbers n = Numbers::one;
+    is >> c1 >> c2;
+    REQUIRE(is);
+    REQUIRE(c1 == Color::GREEN);
+    REQUIRE(c2 == Color::RED);
+    is >> n;
+    REQUIRE(is.fail());
+    REQUIRE(n == Numbers::one);
+    REQUIRE(is.eof());
+  }
+
+  SECTION("out_of_range_consumed") {
+    std::istringstream is{"000000000000000000000000000099999999999999999999999 RED"};
+    Color c = Color::GREEN;
+    is >> c;
+    REQUIRE(is.fail());
+    REQUIRE(c == Color::GREEN);
+    is.clear();
+    is >> c;
+    REQUIRE(is);
+    REQUIRE(c == Color::RED);
+  }
+
+  SECTION("wide") {
+    std::wistringstream is{L"Down 85"};
+    Directions d1 = Directions::Left, d2 = Directions::Left;
+    is >> d1 >> d2;
+    REQUIRE(is);
+    REQUIRE(d1 == Directions::Down);
+    REQUIRE(d2 == Directions::Up);
+  }
 }
 
 TEST_CASE("bitwise_operators") {
@@ -415,6 +1004,434 @@ TEST_CASE("bitwise_operators") {
   }
 }
 
+TEST_CASE("enum_array") {
+  constexpr enum_array<Color, int> ca{{1, 2, 3}};
+  static_assert(ca.size() == 3);
+  static_assert(ca[Color::GREEN] == 2);
+  REQUIRE(ca[Color::RED] == 1);
+  REQUIRE(ca[Color::BLUE] == 3);
+  REQUIRE(ca.find(static_cast<Color>(0)) == nullptr);
+
+  enum_array<Directions, std::string_view> da{};
+  for (auto [e, v] : da) {
+    v = enum_name(e);
+  }
+  REQUIRE(da[Directions::Left] == "Left");
+  REQUIRE(da[Directions::Right] == "Right");
+  REQUIRE(*da.find(Directions::Up) == "Up");
+
+  enum_array<number, int> na{};
+  na.fill(7);
+  na[number::two] = 8;
+  REQUIRE(na == enum_array<number, int>{{7, 8, 7}});
+  REQUIRE(na != enum_array<number, int>{{7, 7, 7}});
+
+  std::size_t i = 0;
+  for (const auto& [e, v] : ca) {
+    REQUIRE(e == enum_value<Color>(i));
+    REQUIRE(v == static_cast<int>(++i));
+  }
+  REQUIRE(i == 3);
+}
+
+TEST_CASE("enum_bitset") {
+  constexpr enum_bitset<Color> cb{Color::RED, Color::BLUE};
+  static_assert(cb.test(Color::RED));
+  static_assert(!cb.test(Color::GREEN));
+  REQUIRE(cb.count() == 2);
+  REQUIRE(cb.size() == 3);
+  REQUIRE_FALSE(cb.test(static_cast<Color>(0)));
+  REQUIRE(cb.to_string() == "RED|BLUE");
+  REQUIRE((~cb).to_string() == "GREEN");
+  REQUIRE((~cb | cb).all());
+  REQUIRE((~cb & cb).none());
+  REQUIRE((cb - enum_bitset<Color>{Color::RED}) == enum_bitset<Color>{Color::BLUE});
+  REQUIRE((cb ^ enum_bitset<Color>{Color::RED, Color::GREEN}).to_string(", ") == "GREEN, BLUE");
+
+  enum_bitset<Directions> db{};
+  REQUIRE(db.none());
+  db.set(Directions::Up).set(Directions::Left);
+  db.flip(Directions::Right);
+  db.reset(Directions::Up);
+  REQUIRE(db.to_string() == "Left|Right");
+  REQUIRE(db.set().all());
+  REQUIRE(db.reset().none());
+
+  enum_bitset<Big> bb{Big::b0, Big::b63, Big::b64, Big::b69};
+  REQUIRE(bb.words().size() == 2);
+  REQUIRE(bb.count() == 4);
+  REQUIRE(bb.to_string() == "b0|b63|b64|b69");
+  REQUIRE((~bb).count() == 66);
+  REQUIRE(enum_bitset<Big>{}.set().count() == 70);
+  REQUIRE((~bb).words()[1] == (std::uint64_t{0x3F} & ~std::uint64_t{0x21}));
+
+  std::vector<Big> values;
+  for (auto v : bb) {
+    values.push_back(v);
+  }
+  REQUIRE(values == std::vector<Big>{Big::b0, Big::b63, Big::b64, Big::b69});
+}
+
+TEST_CASE("atomic_enum_bitset") {
+  atomic_enum_bitset<Color> cb{};
+  REQUIRE_FALSE(cb.fetch_set(Color::RED));
+  REQUIRE(cb.fetch_set(Color::RED));
+  REQUIRE(cb.test(Color::RED));
+  REQUIRE_FALSE(cb.test(Color::GREEN));
+  REQUIRE_FALSE(cb.fetch_set(static_cast<Color>(0)));
+  REQUIRE(cb.snapshot() == enum_bitset<Color>{Color::RED});
+  REQUIRE(cb.fetch_reset(Color::RED));
+  REQUIRE_FALSE(cb.fetch_reset(Color::RED));
+  REQUIRE(cb.snapshot().none());
+
+  atomic_enum_bitset<Big> bb{enum_bitset<Big>{Big::b1, Big::b65}};
+  REQUIRE(bb.snapshot().to_string() == "b1|b65");
+  bb.reset();
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&bb, t] {
+      for (std::size_t i = t; i < enum_count<Big>(); i += 4) {
+        bb.fetch_set(enum_value<Big>(i), std::memory_order_relaxed);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  REQUIRE(bb.snapshot().all());
+}
+
+TEST_CASE("enum_counter") {
+  auto counter = std::make_unique<enum_counter<Directions, 4>>();
+  counter->increment(Directions::Up);
+  counter->increment(Directions::Up, 2);
+  counter->increment(static_cast<Directions>(0));
+  REQUIRE(counter->count(Directions::Up) == 3);
+  REQUIRE(counter->count(Directions::Down) == 0);
+  REQUIRE(counter->count(static_cast<Directions>(0)) == 0);
+  counter->reset();
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < 8; ++t) {
+    threads.emplace_back([&counter] {
+      for (std::size_t i = 0; i < 1000; ++i) {
+        counter->increment(enum_value<Directions>(i % enum_count<Directions>()));
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  auto snapshot = counter->snapshot();
+  REQUIRE(snapshot.size() == 4);
+  REQUIRE(std::get<0>(snapshot[0]) == Directions::Left);
+  REQUIRE(std::get<1>(snapshot[0]) == "Left");
+  for (const auto& [value, name, count] : snapshot) {
+    REQUIRE(enum_name(value) == name);
+    REQUIRE(count == 2000);
+  }
+}
+
+TEST_CASE("packed_enum_vector") {
+  static_assert(packed_enum_vector<Color>::bits_per_value == 2);
+  static_assert(packed_enum_vector<Directions>::bits_per_value == 2);
+  static_assert(packed_enum_vector<Big>::bits_per_value == 7);
+  static_assert(packed_enum_vector<Big>::values_per_word == 9);
+
+  packed_enum_vector<Color> cv{};
+  REQUIRE(cv.empty());
+  cv.push_back(Color::BLUE);
+  cv.push_back(Color::RED);
+  cv.push_back(Color::GREEN);
+  REQUIRE(cv.size() == 3);
+  REQUIRE(cv[0] == Color::BLUE);
+  REQUIRE(cv[1] == Color::RED);
+  REQUIRE(cv[2] == Color::GREEN);
+  cv.set(1, Color::GREEN);
+  REQUIRE(cv[1] == Color::GREEN);
+  REQUIRE(cv.words().size() == 1);
+
+  std::vector<Big> bigs;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    bigs.push_back(enum_value<Big>((i * 7) % enum_count<Big>()));
+  }
+  packed_enum_vector<Big> bv{5, Big::b3};
+  bv.pack(bigs.data(), bigs.size());
+  REQUIRE(bv.size() == 1005);
+  REQUIRE(bv.words().size() == (1005 + 8) / 9);
+  for (std::size_t i = 0; i < 5; ++i) {
+    REQUIRE(bv[i] == Big::b3);
+  }
+  std::vector<Big> unpacked(bigs.size());
+  bv.unpack(5, unpacked.size(), unpacked.data());
+  REQUIRE(unpacked == bigs);
+
+  std::vector<Directions> directions;
+  for (std::size_t i = 0; i < 100; ++i) {
+    directions.push_back(enum_value<Directions>(i % enum_count<Directions>()));
+  }
+  packed_enum_vector<Directions> dv{};
+  dv.pack(directions.data(), directions.size());
+  std::vector<Directions> tail(90);
+  dv.unpack(10, tail.size(), tail.data());
+  REQUIRE(tail == std::vector<Directions>(directions.begin() + 10, directions.end()));
+
+  // Values without name are rejected, storage is not modified.
+  const auto words = dv.words();
+  directions[50] = static_cast<Directions>(0);
+  REQUIRE_FALSE(dv.try_pack(directions.data(), directions.size()));
+  REQUIRE_FALSE(dv.try_push_back(static_cast<Directions>(-121)));
+  REQUIRE_FALSE(dv.try_set(0, static_cast<Directions>(121)));
+  REQUIRE(dv.size() == 100);
+  REQUIRE(dv.words() == words);
+  REQUIRE(dv.try_set(0, Directions::Right));
+  REQUIRE(dv[0] == Directions::Right);
+  REQUIRE(dv.try_push_back(Directions::Down));
+  REQUIRE(dv.size() == 101);
+  const std::array<Color, 2> colors = {{Color::RED, static_cast<Color>(-13)}};
+  REQUIRE(cv.try_pack(colors.data(), 1));
+  REQUIRE_FALSE(cv.try_pack(colors.data(), 2));
+  REQUIRE(cv.size() == 4);
+  REQUIRE(cv[3] == Color::RED);
+  dv.resize(102, Directions::Up);
+  REQUIRE(dv[101] == Directions::Up);
+  dv.clear();
+  REQUIRE(dv.empty());
+}
+
+TEST_CASE("enum_switch") {
+  auto to_name = [](auto v) -> std::string_view { return enum_name<decltype(v)::value>(); };
+  auto to_integer = [](auto v) { return static_cast<int>(decltype(v)::value) * 2; };
+
+  constexpr auto cr = enum_switch(to_integer, Color::RED);
+  static_assert(cr == -24);
+  REQUIRE(enum_switch(to_name, Color::GREEN) == "GREEN");
+  REQUIRE(enum_switch(to_name, Color::BLUE) == "BLUE");
+  REQUIRE(enum_switch(to_name, static_cast<Color>(0)).empty());
+  REQUIRE(enum_switch(to_integer, static_cast<Color>(0), [](Color c) { return static_cast<int>(c) - 1; }) == -1);
+  REQUIRE(enum_switch(to_integer, static_cast<Color>(100), [](Color) { return 42; }) == 42);
+
+  REQUIRE(enum_switch(to_name, Numbers::three) == "three");
+  REQUIRE(enum_switch(to_name, Numbers::many).empty());
+  REQUIRE(enum_switch(to_name, Directions::Left) == "Left");
+  REQUIRE(enum_switch(to_name, Directions::Up) == "Up");
+  REQUIRE(enum_switch(to_name, number::two) == "two");
+  REQUIRE(enum_switch(to_name, number::four).empty());
+  REQUIRE(enum_switch(to_name, Big::b69) == "b69");
+  REQUIRE(enum_switch(to_name, static_cast<Big>(70)).empty());
+
+  static_assert(magic_enum::detail::switch_by_value_v<Directions>);
+  static_assert(!magic_enum::detail::switch_by_value_v<Wide>);
+  REQUIRE(enum_switch(to_name, Directions::Down) == "Down");
+  REQUIRE(enum_switch(to_name, static_cast<Directions>(0)).empty());
+  REQUIRE(enum_switch(to_name, Wide::low) == "low");
+  REQUIRE(enum_switch(to_name, Wide::high) == "high");
+  REQUIRE(enum_switch(to_name, static_cast<Wide>(1), [](Wide) { return std::string_view{"none"}; }) == "none");
+
+  int calls = 0;
+  enum_switch([&calls](auto v) { calls += static_cast<int>(decltype(v)::value); }, Planet::Earth);
+  enum_switch([&calls](auto) { calls += 100; }, static_cast<Planet>(0));
+  REQUIRE(calls == 3);
+}
+
+TEST_CASE("enum_fuse") {
+  constexpr auto cn = enum_fuse(Color::RED, Numbers::one);
+  static_assert(cn.value() == 0);
+  REQUIRE(enum_fuse(Color::RED, Numbers::three).value() == 2);
+  REQUIRE(enum_fuse(Color::GREEN, Numbers::one).value() == 3);
+  REQUIRE(enum_fuse(Color::BLUE, Numbers::three).value() == 8);
+  REQUIRE(enum_fuse(Directions::Right).value() == 3);
+  REQUIRE(enum_fuse(Color::BLUE, Directions::Up, number::two).value() == (2 * 4 + 2) * 3 + 1);
+  REQUIRE_FALSE(enum_fuse(Color::RED, Numbers::many).has_value());
+  REQUIRE_FALSE(enum_fuse(static_cast<Color>(0), Numbers::one).has_value());
+
+  std::vector<std::size_t> keys;
+  for (auto c : enum_values<Color>()) {
+    for (auto d : enum_values<Directions>()) {
+      keys.push_back(enum_fuse(c, d).value());
+    }
+  }
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    REQUIRE(keys[i] == i);
+  }
+}
+
+TEST_CASE("enum_fuse_switch") {
+  auto to_name = [](auto c, auto d) {
+    return std::string{enum_name<decltype(c)::value>()} + "/" + std::string{enum_name<decltype(d)::value>()};
+  };
+
+  for (auto c : enum_values<Color>()) {
+    for (auto d : enum_values<Directions>()) {
+      REQUIRE(enum_fuse_switch(to_name, c, d) == std::string{enum_name(c)} + "/" + std::string{enum_name(d)});
+    }
+  }
+  REQUIRE(enum_fuse_switch(to_name, static_cast<Color>(0), Directions::Up).empty());
+
+  constexpr auto sum = enum_fuse_switch([](auto a, auto b, auto c) { return static_cast<int>(decltype(a)::value) + static_cast<int>(decltype(b)::value) + static_cast<int>(decltype(c)::value); },
+                                        Color::GREEN, Numbers::two, Directions::Down);
+  static_assert(sum == 7 + 20 - 42);
+
+  int calls = 0;
+  enum_fuse_switch([&calls](auto, auto) { ++calls; }, Planet::Venus, Color::RED);
+  enum_fuse_switch([&calls](auto, auto) { ++calls; }, Planet::Venus, static_cast<Color>(1));
+  REQUIRE(calls == 1);
+}
+
+enum class Connection { Closed, Connecting, Open };
+
+enum class ConnectionEvent { Dial, Established, Hangup };
+
+constexpr enum_transition_table<Connection, ConnectionEvent> connection_transitions{{
+    {Connection::Closed, ConnectionEvent::Dial, Connection::Connecting},
+    {Connection::Closed, ConnectionEvent::Established, Connection::Closed},
+    {Connection::Closed, ConnectionEvent::Hangup, Connection::Closed},
+    {Connection::Connecting, ConnectionEvent::Dial, Connection::Connecting},
+    {Connection::Connecting, ConnectionEvent::Established, Connection::Open},
+    {Connection::Connecting, ConnectionEvent::Hangup, Connection::Closed},
+    {Connection::Open, ConnectionEvent::Dial, Connection::Open},
+    {Connection::Open, ConnectionEvent::Established, Connection::Open},
+    {Connection::Open, ConnectionEvent::Hangup, Connection::Closed},
+}};
+
+static_assert(connection_transitions.complete());
+
+TEST_CASE("enum_fsm") {
+  SECTION("transition_table") {
+    constexpr enum_transition_table<Connection, ConnectionEvent> partial{{
+        {Connection::Closed, ConnectionEvent::Dial, Connection::Connecting},
+        {Connection::Connecting, ConnectionEvent::Established, Connection::Open},
+    }};
+    static_assert(!partial.complete());
+    static_assert(partial.target(Connection::Closed, ConnectionEvent::Dial) == Connection::Connecting);
+    REQUIRE(partial.missing().value() == std::pair{Connection::Closed, ConnectionEvent::Established});
+    REQUIRE_FALSE(partial.target(Connection::Open, ConnectionEvent::Hangup).has_value());
+    REQUIRE_FALSE(partial.target(static_cast<Connection>(10), ConnectionEvent::Hangup).has_value());
+
+    enum_transition_table<Connection, ConnectionEvent> t{};
+    t.add(Connection::Open, ConnectionEvent::Hangup, Connection::Closed);
+    REQUIRE(t.target(Connection::Open, ConnectionEvent::Hangup) == Connection::Closed);
+  }
+
+  SECTION("fire") {
+    enum_fsm<Connection, ConnectionEvent> fsm{connection_transitions, Connection::Closed};
+    std::vector<std::string> trace;
+    for (auto s : enum_values<Connection>()) {
+      fsm.on_enter(s, [&trace](Connection from, ConnectionEvent event, Connection to) {
+        trace.push_back(std::string{enum_name(from)} + " -" + std::string{enum_name(event)} + "-> " + std::string{enum_name(to)});
+      });
+    }
+
+    REQUIRE(fsm.fire(ConnectionEvent::Dial));
+    REQUIRE(fsm.state() == Connection::Connecting);
+    REQUIRE(fsm.fire(ConnectionEvent::Established));
+    REQUIRE(fsm.state() == Connection::Open);
+    REQUIRE_FALSE(fsm.fire(static_cast<ConnectionEvent>(10)));
+    REQUIRE(fsm.fire(ConnectionEvent::Hangup));
+    REQUIRE(fsm.state() == Connection::Closed);
+    REQUIRE(trace == std::vector<std::string>{"Closed -Dial-> Connecting", "Connecting -Established-> Open", "Open -Hangup-> Closed"});
+
+    constexpr enum_transition_table<Connection, ConnectionEvent> partial{{
+        {Connection::Closed, ConnectionEvent::Dial, Connection::Connecting},
+    }};
+    enum_fsm<Connection, ConnectionEvent> p{partial, Connection::Closed};
+    REQUIRE_FALSE(p.fire(ConnectionEvent::Hangup));
+    REQUIRE(p.state() == Connection::Closed);
+  }
+
+  SECTION("trace") {
+    enum_fsm<Connection, ConnectionEvent> fsm{connection_transitions, Connection::Closed};
+    REQUIRE(fsm.state_name() == "Closed");
+    std::vector<std::string> trace;
+    fsm.on_trace([&trace](std::string_view from, std::string_view event, std::string_view to) {
+      trace.push_back(std::string{from} + " -" + std::string{event} + "-> " + std::string{to});
+    });
+    REQUIRE(fsm.fire(ConnectionEvent::Dial));
+    REQUIRE(fsm.state_name() == "Connecting");
+    REQUIRE_FALSE(fsm.fire(static_cast<ConnectionEvent>(10)));
+    REQUIRE(fsm.fire(ConnectionEvent::Hangup));
+    REQUIRE(trace == std::vector<std::string>{"Closed -Dial-> Connecting", "Connecting -Hangup-> Closed"});
+  }
+
+  SECTION("temporary_table") {
+    // Table is copied into state machine, so temporary table does not dangle.
+    enum_fsm<Connection, ConnectionEvent> fsm{enum_transition_table<Connection, ConnectionEvent>{{
+        {Connection::Closed, ConnectionEvent::Dial, Connection::Connecting},
+        {Connection::Connecting, ConnectionEvent::Hangup, Connection::Closed},
+    }}, Connection::Closed};
+    REQUIRE(fsm.fire(ConnectionEvent::Dial));
+    REQUIRE(fsm.state() == Connection::Connecting);
+    REQUIRE_FALSE(fsm.fire(ConnectionEvent::Established));
+    REQUIRE(fsm.fire(ConnectionEvent::Hangup));
+    REQUIRE(fsm.state() == Connection::Closed);
+  }
+}
+
+template <>
+struct magic_enum::enable_enum_format<Color> : std::true_type {};
+
+template <>
+struct magic_enum::enable_enum_format<Directions> : std::true_type {};
+
+template <>
+struct magic_enum::enable_enum_format<Numbers> : std::true_type {};
+
+template <>
+struct magic_enum::enable_enum_format<number> : std::true_type {};
+
+TEST_CASE("enum_format_max_size") {
+  static_assert(magic_enum::enum_format_max_size<Color>() == 35);
+  static_assert(magic_enum::enum_format_max_size<number>() == 66);
+  static_assert(magic_enum::enum_format_max_size<Big>() == 10);
+  REQUIRE(magic_enum::enum_format_max_size<Planet>() == 35);
+}
+
+#if defined(__cpp_lib_format)
+TEST_CASE("std::format") {
+  REQUIRE(std::format("{}", Color::RED) == "RED");
+  REQUIRE(std::format("{:s}", Directions::Up) == "Up");
+  REQUIRE(std::format("{:d}", Color::RED) == "-12");
+  REQUIRE(std::format("{:x}", Numbers::three) == "1e");
+  REQUIRE(std::format("{}", Numbers::many) == "127");
+  REQUIRE(std::format("{}|{:d}", number::one, number::one) == "one|100");
+  REQUIRE(std::format("{:>8}", Color::RED) == "     RED");
+  REQUIRE(std::format("{:*<6s}|", Directions::Up) == "Up****|");
+  REQUIRE(std::format("{:^7}", Numbers::many) == "  127  ");
+  REQUIRE(std::format("{:+05d}", Color::GREEN) == "+0007");
+  REQUIRE(std::format("{:#x}", Numbers::three) == "0x1e");
+  REQUIRE(std::format("{:>{}}", Color::BLUE, 6) == "  BLUE");
+  REQUIRE_FALSE(std::is_default_constructible_v<std::formatter<std::errc, char>>);
+  auto cr = Color::RED;
+  REQUIRE_THROWS_AS(std::vformat("{:q}", std::make_format_args(cr)), std::format_error);
+}
+#endif
+
+#if defined(MAGIC_ENUM_ENABLE_FMT)
+TEST_CASE("fmt::format") {
+  REQUIRE(fmt::format("{}", Color::RED) == "RED");
+  REQUIRE(fmt::format("{:s}", Directions::Up) == "Up");
+  REQUIRE(fmt::format("{:d}", Color::RED) == "-12");
+  REQUIRE(fmt::format("{:x}", Numbers::three) == "1e");
+  REQUIRE(fmt::format("{}", Numbers::many) == "127");
+  REQUIRE(fmt::format("{}|{:d}", number::one, number::one) == "one|100");
+  REQUIRE(fmt::format("{:>8}", Color::RED) == "     RED");
+  REQUIRE(fmt::format("{:*<6s}|", Directions::Up) == "Up****|");
+  REQUIRE(fmt::format("{:^7}", Numbers::many) == "  127  ");
+  REQUIRE(fmt::format("{:+05d}", Color::GREEN) == "+0007");
+  REQUIRE(fmt::format("{:#x}", Numbers::three) == "0x1e");
+  REQUIRE(fmt::format("{:>{}}", Color::BLUE, 6) == "  BLUE");
+  REQUIRE(fmt::format("{:#b}", static_cast<Color>((std::numeric_limits<int>::min)())).size() == magic_enum::enum_format_max_size<Color>());
+  REQUIRE_FALSE(fmt::has_formatter<Wide, fmt::format_context>::value);
+  std::string out;
+  out.reserve(magic_enum::enum_format_max_size<Directions>());
+  fmt::format_to(std::back_inserter(out), "{}", Directions::Right);
+  REQUIRE(out == "Right");
+  REQUIRE_THROWS_AS(fmt::format(fmt::runtime("{:q}"), Color::RED), fmt::format_error);
+}
+#endif
+
 TEST_CASE("type_traits") {
   REQUIRE_FALSE(is_unscoped_enum_v<Color>);
   REQUIRE_FALSE(is_unscoped_enum_v<Numbers>);
@@ -431,3 +1448,23 @@ TEST_CASE("type_traits") {
   REQUIRE_FALSE(is_fixed_enum_v<Directions>);
   REQUIRE(is_fixed_enum_v<number>);
 }
+
+TEST_CASE("extern_tables") {
+  REQUIRE(enum_name(Planet::Mercury) == "Mercury");
+  REQUIRE(enum_name(Planet::Earth) == "Earth");
+  REQUIRE(enum_name(static_cast<Planet>(0)).empty());
+
+  REQUIRE(enum_cast<Planet>("Venus").value() == Planet::Venus);
+  REQUIRE_FALSE(enum_cast<Planet>("Mars").has_value());
+
+  REQUIRE(enum_cast<Planet>(3).value() == Planet::Earth);
+  REQUIRE_FALSE(enum_cast<Planet>(4).has_value());
+
+  REQUIRE(enum_count<Planet>() == 3);
+  REQUIRE(enum_names<Planet>() == std::array<std::string_view, 3>{{"Mercury", "Venus", "Earth"}});
+
+  using namespace magic_enum::ostream_operators;
+  std::stringstream ss;
+  ss << Planet::Venus << static_cast<Planet>(0);
+  REQUIRE(ss.str() == "Venus0");
+}